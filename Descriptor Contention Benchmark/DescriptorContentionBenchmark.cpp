@@ -0,0 +1,104 @@
+#include <d3d12.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentDescriptorAllocator.h"
+#include "StubDevice.h"
+
+struct BenchmarkResult
+{
+	double milliseconds = 0.0;
+	size_t contendedLocks = 0;
+};
+
+BenchmarkResult RunContention(StubDevice* device, unsigned int nrOfThreads,
+	size_t reservationsPerThread, size_t descriptorsPerReservation)
+{
+	ConcurrentDescriptorAllocator allocator;
+	allocator.Initialize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, device,
+		nrOfThreads * descriptorsPerReservation);
+
+	std::atomic<bool> start{ false };
+	std::vector<std::thread> threads;
+	threads.reserve(nrOfThreads);
+
+	for (unsigned int i = 0; i < nrOfThreads; ++i)
+	{
+		threads.emplace_back([&]()
+		{
+			while (!start)
+				std::this_thread::yield();
+
+			for (size_t j = 0; j < reservationsPerThread; ++j)
+			{
+				DescriptorReservation reservation =
+					allocator.Reserve(descriptorsPerReservation);
+
+				while (reservation.AllocateDescriptor() != size_t(-1));
+			}
+		});
+	}
+
+	auto begin = std::chrono::steady_clock::now();
+	start = true;
+
+	for (auto& thread : threads)
+		thread.join();
+
+	auto end = std::chrono::steady_clock::now();
+
+	BenchmarkResult toReturn;
+	toReturn.milliseconds =
+		std::chrono::duration<double, std::milli>(end - begin).count();
+	toReturn.contendedLocks = allocator.NrOfContendedLocks();
+	return toReturn;
+}
+
+int main(int argc, char* argv[])
+{
+	unsigned int maxThreads = std::thread::hardware_concurrency();
+	size_t reservationsPerThread = 100000;
+	size_t descriptorsPerReservation = 16;
+
+	if (argc > 1)
+		maxThreads = static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10));
+	if (argc > 2)
+		reservationsPerThread = std::strtoull(argv[2], nullptr, 10);
+	if (argc > 3)
+		descriptorsPerReservation = std::strtoull(argv[3], nullptr, 10);
+
+	if (maxThreads == 0)
+		maxThreads = 1;
+
+	std::printf("%8s %14s %12s %14s %16s\n", "threads", "reservations",
+		"total ms", "ns/reserve", "contended locks");
+
+	StubDevice device;
+
+	try
+	{
+		for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+		{
+			BenchmarkResult result = RunContention(&device, threads,
+				reservationsPerThread, descriptorsPerReservation);
+			size_t totalReservations = threads * reservationsPerThread;
+
+			std::printf("%8u %14zu %12.2f %14.1f %16zu\n", threads,
+				totalReservations, result.milliseconds,
+				result.milliseconds * 1000000.0 / totalReservations,
+				result.contendedLocks);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::printf("Benchmark failed: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,375 @@
+#include "StubDevice.h"
+
+StubDescriptorHeap::StubDescriptorHeap(ID3D12Device* owningDevice,
+	const D3D12_DESCRIPTOR_HEAP_DESC& heapDesc, UINT descriptorSize) :
+	device(owningDevice), desc(heapDesc),
+	descriptors(size_t(heapDesc.NumDescriptors) * descriptorSize)
+{
+	// EMPTY
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::QueryInterface(REFIID riid,
+	void** ppvObject)
+{
+	if (riid == __uuidof(IUnknown) || riid == __uuidof(ID3D12DescriptorHeap))
+	{
+		AddRef();
+		*ppvObject = static_cast<ID3D12DescriptorHeap*>(this);
+		return S_OK;
+	}
+
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE StubDescriptorHeap::AddRef()
+{
+	return ++references;
+}
+
+ULONG STDMETHODCALLTYPE StubDescriptorHeap::Release()
+{
+	ULONG toReturn = --references;
+
+	if (toReturn == 0)
+		delete this;
+
+	return toReturn;
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::GetPrivateData(REFGUID,
+	UINT*, void*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::SetPrivateData(REFGUID, UINT,
+	const void*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::SetPrivateDataInterface(REFGUID,
+	const IUnknown*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::SetName(LPCWSTR)
+{
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE StubDescriptorHeap::GetDevice(REFIID riid,
+	void** ppvDevice)
+{
+	return device->QueryInterface(riid, ppvDevice);
+}
+
+D3D12_DESCRIPTOR_HEAP_DESC STDMETHODCALLTYPE StubDescriptorHeap::GetDesc()
+{
+	return desc;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE
+StubDescriptorHeap::GetCPUDescriptorHandleForHeapStart()
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE toReturn;
+	toReturn.ptr = reinterpret_cast<SIZE_T>(descriptors.data());
+	return toReturn;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE
+StubDescriptorHeap::GetGPUDescriptorHandleForHeapStart()
+{
+	D3D12_GPU_DESCRIPTOR_HANDLE toReturn;
+	toReturn.ptr = 0;
+	return toReturn;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::QueryInterface(REFIID riid,
+	void** ppvObject)
+{
+	if (riid == __uuidof(IUnknown) || riid == __uuidof(ID3D12Device))
+	{
+		AddRef();
+		*ppvObject = static_cast<ID3D12Device*>(this);
+		return S_OK;
+	}
+
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE StubDevice::AddRef()
+{
+	return ++references;
+}
+
+ULONG STDMETHODCALLTYPE StubDevice::Release()
+{
+	// The benchmark owns the device on the stack
+	return --references;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::GetPrivateData(REFGUID, UINT*, void*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::SetPrivateData(REFGUID, UINT,
+	const void*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::SetPrivateDataInterface(REFGUID,
+	const IUnknown*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::SetName(LPCWSTR)
+{
+	return S_OK;
+}
+
+UINT STDMETHODCALLTYPE StubDevice::GetNodeCount()
+{
+	return 1;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateCommandQueue(
+	const D3D12_COMMAND_QUEUE_DESC*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateCommandAllocator(
+	D3D12_COMMAND_LIST_TYPE, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateGraphicsPipelineState(
+	const D3D12_GRAPHICS_PIPELINE_STATE_DESC*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateComputePipelineState(
+	const D3D12_COMPUTE_PIPELINE_STATE_DESC*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateCommandList(UINT,
+	D3D12_COMMAND_LIST_TYPE, ID3D12CommandAllocator*, ID3D12PipelineState*,
+	REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CheckFeatureSupport(D3D12_FEATURE,
+	void*, UINT)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateDescriptorHeap(
+	const D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc, REFIID riid,
+	void** ppvHeap)
+{
+	if (riid != __uuidof(ID3D12DescriptorHeap))
+		return E_NOINTERFACE;
+
+	*ppvHeap = static_cast<ID3D12DescriptorHeap*>(new StubDescriptorHeap(
+		this, *pDescriptorHeapDesc, descriptorSize));
+	return S_OK;
+}
+
+UINT STDMETHODCALLTYPE StubDevice::GetDescriptorHandleIncrementSize(
+	D3D12_DESCRIPTOR_HEAP_TYPE)
+{
+	return descriptorSize;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateRootSignature(UINT, const void*,
+	SIZE_T, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateConstantBufferView(
+	const D3D12_CONSTANT_BUFFER_VIEW_DESC*, D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateShaderResourceView(ID3D12Resource*,
+	const D3D12_SHADER_RESOURCE_VIEW_DESC*, D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateUnorderedAccessView(ID3D12Resource*,
+	ID3D12Resource*, const D3D12_UNORDERED_ACCESS_VIEW_DESC*,
+	D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateRenderTargetView(ID3D12Resource*,
+	const D3D12_RENDER_TARGET_VIEW_DESC*, D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateDepthStencilView(ID3D12Resource*,
+	const D3D12_DEPTH_STENCIL_VIEW_DESC*, D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CreateSampler(const D3D12_SAMPLER_DESC*,
+	D3D12_CPU_DESCRIPTOR_HANDLE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CopyDescriptors(UINT,
+	const D3D12_CPU_DESCRIPTOR_HANDLE*, const UINT*, UINT,
+	const D3D12_CPU_DESCRIPTOR_HANDLE*, const UINT*, D3D12_DESCRIPTOR_HEAP_TYPE)
+{
+	// EMPTY
+}
+
+void STDMETHODCALLTYPE StubDevice::CopyDescriptorsSimple(UINT,
+	D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_CPU_DESCRIPTOR_HANDLE,
+	D3D12_DESCRIPTOR_HEAP_TYPE)
+{
+	// EMPTY
+}
+
+D3D12_RESOURCE_ALLOCATION_INFO STDMETHODCALLTYPE
+StubDevice::GetResourceAllocationInfo(UINT, UINT, const D3D12_RESOURCE_DESC*)
+{
+	D3D12_RESOURCE_ALLOCATION_INFO toReturn;
+	toReturn.SizeInBytes = 0;
+	toReturn.Alignment = 0;
+	return toReturn;
+}
+
+D3D12_HEAP_PROPERTIES STDMETHODCALLTYPE StubDevice::GetCustomHeapProperties(
+	UINT, D3D12_HEAP_TYPE)
+{
+	D3D12_HEAP_PROPERTIES toReturn;
+	ZeroMemory(&toReturn, sizeof(toReturn));
+	return toReturn;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateCommittedResource(
+	const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC*,
+	D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateHeap(const D3D12_HEAP_DESC*,
+	REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreatePlacedResource(ID3D12Heap*,
+	UINT64, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES,
+	const D3D12_CLEAR_VALUE*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateReservedResource(
+	const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*,
+	REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateSharedHandle(ID3D12DeviceChild*,
+	const SECURITY_ATTRIBUTES*, DWORD, LPCWSTR, HANDLE*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::OpenSharedHandle(HANDLE, REFIID,
+	void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::OpenSharedHandleByName(LPCWSTR, DWORD,
+	HANDLE*)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::MakeResident(UINT,
+	ID3D12Pageable* const*)
+{
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::Evict(UINT, ID3D12Pageable* const*)
+{
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateFence(UINT64, D3D12_FENCE_FLAGS,
+	REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::GetDeviceRemovedReason()
+{
+	return S_OK;
+}
+
+void STDMETHODCALLTYPE StubDevice::GetCopyableFootprints(
+	const D3D12_RESOURCE_DESC*, UINT, UINT, UINT64,
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT*, UINT*, UINT64*, UINT64*)
+{
+	// EMPTY
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateQueryHeap(
+	const D3D12_QUERY_HEAP_DESC*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::SetStablePowerState(BOOL)
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE StubDevice::CreateCommandSignature(
+	const D3D12_COMMAND_SIGNATURE_DESC*, ID3D12RootSignature*, REFIID, void**)
+{
+	return E_NOTIMPL;
+}
+
+void STDMETHODCALLTYPE StubDevice::GetResourceTiling(ID3D12Resource*, UINT*,
+	D3D12_PACKED_MIP_INFO*, D3D12_TILE_SHAPE*, UINT*, UINT,
+	D3D12_SUBRESOURCE_TILING*)
+{
+	// EMPTY
+}
+
+LUID STDMETHODCALLTYPE StubDevice::GetAdapterLuid()
+{
+	LUID toReturn;
+	toReturn.LowPart = 0;
+	toReturn.HighPart = 0;
+	return toReturn;
+}
\ No newline at end of file
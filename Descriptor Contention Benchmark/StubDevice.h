@@ -0,0 +1,184 @@
+#pragma once
+
+#include <d3d12.h>
+#include <atomic>
+#include <vector>
+
+class StubDescriptorHeap : public ID3D12DescriptorHeap
+{
+private:
+	std::atomic<ULONG> references{ 1 };
+	ID3D12Device* device = nullptr;
+	D3D12_DESCRIPTOR_HEAP_DESC desc;
+	std::vector<unsigned char> descriptors;
+
+public:
+	StubDescriptorHeap(ID3D12Device* owningDevice,
+		const D3D12_DESCRIPTOR_HEAP_DESC& heapDesc, UINT descriptorSize);
+	virtual ~StubDescriptorHeap() = default;
+	StubDescriptorHeap(const StubDescriptorHeap& other) = delete;
+	StubDescriptorHeap& operator=(const StubDescriptorHeap& other) = delete;
+	StubDescriptorHeap(StubDescriptorHeap&& other) = delete;
+	StubDescriptorHeap& operator=(StubDescriptorHeap&& other) = delete;
+
+	HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+		void** ppvObject) override;
+	ULONG STDMETHODCALLTYPE AddRef() override;
+	ULONG STDMETHODCALLTYPE Release() override;
+
+	HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid, UINT* pDataSize,
+		void* pData) override;
+	HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid, UINT DataSize,
+		const void* pData) override;
+	HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid,
+		const IUnknown* pData) override;
+	HRESULT STDMETHODCALLTYPE SetName(LPCWSTR Name) override;
+
+	HRESULT STDMETHODCALLTYPE GetDevice(REFIID riid, void** ppvDevice) override;
+
+	D3D12_DESCRIPTOR_HEAP_DESC STDMETHODCALLTYPE GetDesc() override;
+	D3D12_CPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE
+		GetCPUDescriptorHandleForHeapStart() override;
+	D3D12_GPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE
+		GetGPUDescriptorHandleForHeapStart() override;
+};
+
+// Only descriptor heap creation and the handle increment size are meaningful,
+// every other call fails or does nothing
+class StubDevice : public ID3D12Device
+{
+private:
+	std::atomic<ULONG> references{ 1 };
+	UINT descriptorSize = 32;
+
+public:
+	StubDevice() = default;
+	virtual ~StubDevice() = default;
+	StubDevice(const StubDevice& other) = delete;
+	StubDevice& operator=(const StubDevice& other) = delete;
+	StubDevice(StubDevice&& other) = delete;
+	StubDevice& operator=(StubDevice&& other) = delete;
+
+	HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+		void** ppvObject) override;
+	ULONG STDMETHODCALLTYPE AddRef() override;
+	ULONG STDMETHODCALLTYPE Release() override;
+
+	HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid, UINT* pDataSize,
+		void* pData) override;
+	HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid, UINT DataSize,
+		const void* pData) override;
+	HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid,
+		const IUnknown* pData) override;
+	HRESULT STDMETHODCALLTYPE SetName(LPCWSTR Name) override;
+
+	UINT STDMETHODCALLTYPE GetNodeCount() override;
+	HRESULT STDMETHODCALLTYPE CreateCommandQueue(
+		const D3D12_COMMAND_QUEUE_DESC* pDesc, REFIID riid,
+		void** ppCommandQueue) override;
+	HRESULT STDMETHODCALLTYPE CreateCommandAllocator(
+		D3D12_COMMAND_LIST_TYPE type, REFIID riid,
+		void** ppCommandAllocator) override;
+	HRESULT STDMETHODCALLTYPE CreateGraphicsPipelineState(
+		const D3D12_GRAPHICS_PIPELINE_STATE_DESC* pDesc, REFIID riid,
+		void** ppPipelineState) override;
+	HRESULT STDMETHODCALLTYPE CreateComputePipelineState(
+		const D3D12_COMPUTE_PIPELINE_STATE_DESC* pDesc, REFIID riid,
+		void** ppPipelineState) override;
+	HRESULT STDMETHODCALLTYPE CreateCommandList(UINT nodeMask,
+		D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* pCommandAllocator,
+		ID3D12PipelineState* pInitialState, REFIID riid,
+		void** ppCommandList) override;
+	HRESULT STDMETHODCALLTYPE CheckFeatureSupport(D3D12_FEATURE Feature,
+		void* pFeatureSupportData, UINT FeatureSupportDataSize) override;
+	HRESULT STDMETHODCALLTYPE CreateDescriptorHeap(
+		const D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc, REFIID riid,
+		void** ppvHeap) override;
+	UINT STDMETHODCALLTYPE GetDescriptorHandleIncrementSize(
+		D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapType) override;
+	HRESULT STDMETHODCALLTYPE CreateRootSignature(UINT nodeMask,
+		const void* pBlobWithRootSignature, SIZE_T blobLengthInBytes,
+		REFIID riid, void** ppvRootSignature) override;
+	void STDMETHODCALLTYPE CreateConstantBufferView(
+		const D3D12_CONSTANT_BUFFER_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CreateShaderResourceView(ID3D12Resource* pResource,
+		const D3D12_SHADER_RESOURCE_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CreateUnorderedAccessView(ID3D12Resource* pResource,
+		ID3D12Resource* pCounterResource,
+		const D3D12_UNORDERED_ACCESS_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CreateRenderTargetView(ID3D12Resource* pResource,
+		const D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CreateDepthStencilView(ID3D12Resource* pResource,
+		const D3D12_DEPTH_STENCIL_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CreateSampler(const D3D12_SAMPLER_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	void STDMETHODCALLTYPE CopyDescriptors(UINT NumDestDescriptorRanges,
+		const D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+		const UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges,
+		const D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+		const UINT* pSrcDescriptorRangeSizes,
+		D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType) override;
+	void STDMETHODCALLTYPE CopyDescriptorsSimple(UINT NumDescriptors,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptorRangeStart,
+		D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRangeStart,
+		D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType) override;
+	D3D12_RESOURCE_ALLOCATION_INFO STDMETHODCALLTYPE GetResourceAllocationInfo(
+		UINT visibleMask, UINT numResourceDescs,
+		const D3D12_RESOURCE_DESC* pResourceDescs) override;
+	D3D12_HEAP_PROPERTIES STDMETHODCALLTYPE GetCustomHeapProperties(
+		UINT nodeMask, D3D12_HEAP_TYPE heapType) override;
+	HRESULT STDMETHODCALLTYPE CreateCommittedResource(
+		const D3D12_HEAP_PROPERTIES* pHeapProperties, D3D12_HEAP_FLAGS HeapFlags,
+		const D3D12_RESOURCE_DESC* pDesc,
+		D3D12_RESOURCE_STATES InitialResourceState,
+		const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riidResource,
+		void** ppvResource) override;
+	HRESULT STDMETHODCALLTYPE CreateHeap(const D3D12_HEAP_DESC* pDesc,
+		REFIID riid, void** ppvHeap) override;
+	HRESULT STDMETHODCALLTYPE CreatePlacedResource(ID3D12Heap* pHeap,
+		UINT64 HeapOffset, const D3D12_RESOURCE_DESC* pDesc,
+		D3D12_RESOURCE_STATES InitialState,
+		const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid,
+		void** ppvResource) override;
+	HRESULT STDMETHODCALLTYPE CreateReservedResource(
+		const D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialState,
+		const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid,
+		void** ppvResource) override;
+	HRESULT STDMETHODCALLTYPE CreateSharedHandle(ID3D12DeviceChild* pObject,
+		const SECURITY_ATTRIBUTES* pAttributes, DWORD Access, LPCWSTR Name,
+		HANDLE* pHandle) override;
+	HRESULT STDMETHODCALLTYPE OpenSharedHandle(HANDLE NTHandle, REFIID riid,
+		void** ppvObj) override;
+	HRESULT STDMETHODCALLTYPE OpenSharedHandleByName(LPCWSTR Name,
+		DWORD Access, HANDLE* pNTHandle) override;
+	HRESULT STDMETHODCALLTYPE MakeResident(UINT NumObjects,
+		ID3D12Pageable* const* ppObjects) override;
+	HRESULT STDMETHODCALLTYPE Evict(UINT NumObjects,
+		ID3D12Pageable* const* ppObjects) override;
+	HRESULT STDMETHODCALLTYPE CreateFence(UINT64 InitialValue,
+		D3D12_FENCE_FLAGS Flags, REFIID riid, void** ppFence) override;
+	HRESULT STDMETHODCALLTYPE GetDeviceRemovedReason() override;
+	void STDMETHODCALLTYPE GetCopyableFootprints(
+		const D3D12_RESOURCE_DESC* pResourceDesc, UINT FirstSubresource,
+		UINT NumSubresources, UINT64 BaseOffset,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT* pLayouts, UINT* pNumRows,
+		UINT64* pRowSizeInBytes, UINT64* pTotalBytes) override;
+	HRESULT STDMETHODCALLTYPE CreateQueryHeap(const D3D12_QUERY_HEAP_DESC* pDesc,
+		REFIID riid, void** ppvHeap) override;
+	HRESULT STDMETHODCALLTYPE SetStablePowerState(BOOL Enable) override;
+	HRESULT STDMETHODCALLTYPE CreateCommandSignature(
+		const D3D12_COMMAND_SIGNATURE_DESC* pDesc,
+		ID3D12RootSignature* pRootSignature, REFIID riid,
+		void** ppvCommandSignature) override;
+	void STDMETHODCALLTYPE GetResourceTiling(ID3D12Resource* pTiledResource,
+		UINT* pNumTilesForEntireResource, D3D12_PACKED_MIP_INFO* pPackedMipDesc,
+		D3D12_TILE_SHAPE* pStandardTileShapeForNonPackedMips,
+		UINT* pNumSubresourceTilings, UINT FirstSubresourceTilingToGet,
+		D3D12_SUBRESOURCE_TILING* pSubresourceTilingsForNonPackedMips) override;
+	LUID STDMETHODCALLTYPE GetAdapterLuid() override;
+};
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <d3d12.h>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
 #include <stdexcept>
 
 #include "FrameBased.h"
@@ -14,22 +17,63 @@ class ComponentDescriptorHeap : public FrameBased<Frames>
 private:
 	struct ComponentOffset
 	{
-		size_t cbvOffset = size_t(-1);
-		size_t srvOffset = size_t(-1);
-		size_t uavOffset = size_t(-1);
+		IdentifierType identifier;
+		std::array<size_t, 5> viewOffsets = { size_t(-1), size_t(-1),
+			size_t(-1), size_t(-1), size_t(-1) };
+		size_t startOffset = size_t(-1);
+		UINT nrOfDescriptors = 0;
+		UINT totalDescriptors = 0;
+		bool dynamic = true;
+		bool written = false;
+		FrameType framesLeftToUpdate = 0;
 	};
 
-	std::unordered_map<IdentifierType, ComponentOffset> componentOffsets;
+	struct RetiredHeap
+	{
+		D3DPtr<ID3D12DescriptorHeap> heap;
+		FrameType framesLeft = 0;
+	};
+
+	struct DescriptorRange
+	{
+		size_t startOffset = 0;
+		size_t nrOfDescriptors = 0;
+	};
+
+	std::vector<ComponentOffset> componentOffsets;
+	std::vector<size_t> changedComponents;
+	std::vector<DescriptorRange> updatedRanges;
+	std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> copyDestinations;
+	std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> copySources;
+	std::vector<UINT> copySizes;
+	size_t descriptorsCopiedLastUpload = 0;
 	ID3D12Device* device;
 	D3DPtr<ID3D12DescriptorHeap> cpuHeap;
 	D3DPtr<ID3D12DescriptorHeap> gpuHeap;
+	std::vector<RetiredHeap> retiredHeaps;
+	bool staticRegionRewritten = false;
+	unsigned int staticDescriptors = 0;
 	unsigned int descriptorsPerFrame = 0;
+	size_t currentStaticOffset = 0;
 	size_t currentOffset = 0;
 	unsigned int descriptorSize = 0;
 
-	void CreateDescriptorHeaps();
+	size_t transientSize = 0;
+	size_t transientHead = 0;
+	size_t transientUsed = 0;
+	std::uint64_t transientWraps = 0;
+	size_t transientAllocatedPerFrame[Frames] = {};
+
+	void CreateDescriptorHeap(D3DPtr<ID3D12DescriptorHeap>& heap,
+		D3D12_DESCRIPTOR_HEAP_FLAGS flags);
 	void StoreDescriptors(D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle,
-		UINT nrOfComponents);
+		size_t offset, UINT nrOfDescriptors);
+	size_t GetTotalDescriptors() const;
+	size_t GetRegionStart(bool dynamic) const;
+	void ReplaceShaderVisibleHeap();
+	void CopyUpdatedRanges();
+	void GrowHeaps();
+	void GrowHeapsIfRequired();
 
 public:
 	ComponentDescriptorHeap() = default;
@@ -43,104 +87,382 @@ public:
 	ComponentDescriptorHeap& operator=(
 		ComponentDescriptorHeap&& other);
 
-	void Initialize(ID3D12Device* deviceToUse,
-		unsigned int maxDescriptorsPerFrame);
+	void Initialize(ID3D12Device* deviceToUse, unsigned int maxStaticDescriptors,
+		unsigned int maxDescriptorsPerFrame, size_t transientDescriptors = 0);
 
-	void AddComponentDescriptors(const IdentifierType& identifier,
+	size_t AddComponent(const IdentifierType& identifier,
+		const ResourceComponent& component, bool dynamic, UINT maxDescriptors);
+	void MarkComponentChanged(size_t componentSlot);
+	const std::vector<size_t>& GetChangedComponents() const;
+	const IdentifierType& GetComponentIdentifier(size_t componentSlot) const;
+	void UpdateComponentDescriptors(size_t componentSlot,
 		const ResourceComponent& component);
-	size_t GetComponentHeapOffset(const IdentifierType& identifier,
-		ViewType viewType);
+	size_t GetComponentHeapOffset(size_t componentSlot, ViewType viewType) const;
+
+	size_t AllocateTransientDescriptors(size_t nrOfDescriptors);
+	void CopyToTransientDescriptors(size_t heapOffset,
+		D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle, UINT nrOfDescriptors);
+	// Changes every time the transient ring wraps and old offsets can be reused
+	std::uint64_t GetTransientWrapCount() const;
 
 	void UploadCurrentFrameHeap();
+	size_t GetDescriptorsCopiedLastUpload() const;
 	ID3D12DescriptorHeap* GetShaderVisibleHeap();
 
 	void SwapFrame() override;
 };
 
 template<FrameType Frames, typename IdentifierType>
-inline void ComponentDescriptorHeap<Frames, IdentifierType>::CreateDescriptorHeaps()
+inline void ComponentDescriptorHeap<Frames, IdentifierType>::CreateDescriptorHeap(
+	D3DPtr<ID3D12DescriptorHeap>& heap, D3D12_DESCRIPTOR_HEAP_FLAGS flags)
 {
 	D3D12_DESCRIPTOR_HEAP_DESC desc;
 	desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-	desc.NumDescriptors = descriptorsPerFrame;
-	desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+	desc.NumDescriptors = std::max(static_cast<UINT>(GetTotalDescriptors()), 1u);
+	desc.Flags = flags;
 	desc.NodeMask = 0;
-	device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&cpuHeap));
-
-	desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-	desc.NumDescriptors = descriptorsPerFrame * Frames;
-	device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&gpuHeap));
+	HRESULT hr = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&heap));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create component descriptor heap");
 }
 
 template<FrameType Frames, typename IdentifierType>
 inline void ComponentDescriptorHeap<Frames, IdentifierType>::StoreDescriptors(
-	D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle, UINT nrOfComponents)
+	D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle, size_t offset,
+	UINT nrOfDescriptors)
 {
+	if (nrOfDescriptors == 0)
+		return;
+
 	auto destinationHandle = cpuHeap->GetCPUDescriptorHandleForHeapStart();
-	destinationHandle.ptr += currentOffset * descriptorSize;
-	device->CopyDescriptorsSimple(nrOfComponents, destinationHandle,
+	destinationHandle.ptr += offset * descriptorSize;
+	device->CopyDescriptorsSimple(nrOfDescriptors, destinationHandle,
 		sourceHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	currentOffset += nrOfComponents;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline size_t
+ComponentDescriptorHeap<Frames, IdentifierType>::GetTotalDescriptors() const
+{
+	return transientSize + staticDescriptors + descriptorsPerFrame * Frames;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline size_t ComponentDescriptorHeap<Frames, IdentifierType>::GetRegionStart(
+	bool dynamic) const
+{
+	return transientSize +
+		(dynamic ? staticDescriptors + descriptorsPerFrame * this->activeFrame : 0);
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void
+ComponentDescriptorHeap<Frames, IdentifierType>::ReplaceShaderVisibleHeap()
+{
+	RetiredHeap retired;
+	retired.heap = std::move(gpuHeap);
+	retired.framesLeft = Frames;
+	retiredHeaps.push_back(std::move(retired));
+	CreateDescriptorHeap(gpuHeap, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
+	staticRegionRewritten = false;
+
+	device->CopyDescriptorsSimple(static_cast<UINT>(GetTotalDescriptors()),
+		gpuHeap->GetCPUDescriptorHandleForHeapStart(),
+		cpuHeap->GetCPUDescriptorHandleForHeapStart(),
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void ComponentDescriptorHeap<Frames, IdentifierType>::GrowHeaps()
+{
+	unsigned int oldStaticDescriptors = staticDescriptors;
+	unsigned int oldDescriptorsPerFrame = descriptorsPerFrame;
+
+	if (currentStaticOffset > staticDescriptors)
+	{
+		staticDescriptors = std::max(static_cast<unsigned int>(currentStaticOffset),
+			staticDescriptors * 2);
+	}
+
+	if (currentOffset > descriptorsPerFrame)
+	{
+		descriptorsPerFrame = std::max(static_cast<unsigned int>(currentOffset),
+			descriptorsPerFrame * 2);
+	}
+
+	D3DPtr<ID3D12DescriptorHeap> oldCpuHeap = std::move(cpuHeap);
+	CreateDescriptorHeap(cpuHeap, D3D12_DESCRIPTOR_HEAP_FLAG_NONE);
+
+	auto oldStart = oldCpuHeap->GetCPUDescriptorHandleForHeapStart();
+	StoreDescriptors(oldStart, 0,
+		static_cast<UINT>(transientSize + oldStaticDescriptors));
+
+	for (FrameType i = 0; i < Frames; ++i)
+	{
+		auto source = oldStart;
+		source.ptr += (transientSize + oldStaticDescriptors +
+			oldDescriptorsPerFrame * i) * descriptorSize;
+		StoreDescriptors(source, transientSize + staticDescriptors +
+			descriptorsPerFrame * i, oldDescriptorsPerFrame);
+	}
+
+	ReplaceShaderVisibleHeap();
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void ComponentDescriptorHeap<Frames, IdentifierType>::GrowHeapsIfRequired()
+{
+	if (cpuHeap != nullptr && (currentStaticOffset > staticDescriptors ||
+		currentOffset > descriptorsPerFrame))
+	{
+		GrowHeaps();
+	}
 }
 
 template<FrameType Frames, typename IdentifierType>
 inline void ComponentDescriptorHeap<Frames, IdentifierType>::Initialize(
-	ID3D12Device* deviceToUse, unsigned int maxDescriptorsPerFrame)
+	ID3D12Device* deviceToUse, unsigned int maxStaticDescriptors,
+	unsigned int maxDescriptorsPerFrame, size_t transientDescriptors)
 {
 	device = deviceToUse;
-	descriptorsPerFrame = maxDescriptorsPerFrame;
+	staticDescriptors = std::max(maxStaticDescriptors,
+		static_cast<unsigned int>(currentStaticOffset));
+	descriptorsPerFrame = std::max(maxDescriptorsPerFrame,
+		static_cast<unsigned int>(currentOffset));
+	transientSize = transientDescriptors;
 	descriptorSize = device->GetDescriptorHandleIncrementSize(
 		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	CreateDescriptorHeaps();
+	CreateDescriptorHeap(cpuHeap, D3D12_DESCRIPTOR_HEAP_FLAG_NONE);
+	CreateDescriptorHeap(gpuHeap, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
 }
 
 template<FrameType Frames, typename IdentifierType>
-inline void
-ComponentDescriptorHeap<Frames, IdentifierType>::AddComponentDescriptors(
-	const IdentifierType& identifier, const ResourceComponent& component)
+inline size_t ComponentDescriptorHeap<Frames, IdentifierType>::AddComponent(
+	const IdentifierType& identifier, const ResourceComponent& component,
+	bool dynamic, UINT maxDescriptors)
 {
+	size_t& offset = dynamic ? currentOffset : currentStaticOffset;
+
 	ComponentOffset toStore;
-	UINT nrOfComponents = static_cast<UINT>(component.NrOfDescriptors());
-	size_t heapStartCurrentFrame = descriptorsPerFrame * this->activeFrame;
+	toStore.identifier = identifier;
+	toStore.nrOfDescriptors = maxDescriptors;
+	toStore.startOffset = offset;
+	toStore.dynamic = dynamic;
+	toStore.framesLeftToUpdate = dynamic ? Frames : 1;
 
 	if (component.HasDescriptorsOfType(ViewType::CBV))
 	{
-		toStore.cbvOffset = currentOffset + heapStartCurrentFrame;
-		StoreDescriptors(component.GetDescriptorHeapCBV(), nrOfComponents);
+		toStore.viewOffsets[static_cast<size_t>(ViewType::CBV)] = offset;
+		offset += toStore.nrOfDescriptors;
 	}
 
 	if (component.HasDescriptorsOfType(ViewType::SRV))
 	{
-		toStore.srvOffset = currentOffset + heapStartCurrentFrame;
-		StoreDescriptors(component.GetDescriptorHeapSRV(), nrOfComponents);
+		toStore.viewOffsets[static_cast<size_t>(ViewType::SRV)] = offset;
+		offset += toStore.nrOfDescriptors;
 	}
 
 	if (component.HasDescriptorsOfType(ViewType::UAV))
 	{
-		toStore.uavOffset = currentOffset + heapStartCurrentFrame;
-		StoreDescriptors(component.GetDescriptorHeapUAV(), nrOfComponents);
+		toStore.viewOffsets[static_cast<size_t>(ViewType::UAV)] = offset;
+		offset += toStore.nrOfDescriptors;
 	}
 
-	componentOffsets[identifier] = toStore;
+	toStore.totalDescriptors = static_cast<UINT>(offset - toStore.startOffset);
+	componentOffsets.push_back(toStore);
+	changedComponents.push_back(componentOffsets.size() - 1);
+
+	return componentOffsets.size() - 1;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void ComponentDescriptorHeap<Frames, IdentifierType>::MarkComponentChanged(
+	size_t componentSlot)
+{
+	auto& offsets = componentOffsets[componentSlot];
+
+	if (offsets.framesLeftToUpdate == 0)
+		changedComponents.push_back(componentSlot);
+
+	offsets.framesLeftToUpdate = offsets.dynamic ? Frames : 1;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline const std::vector<size_t>&
+ComponentDescriptorHeap<Frames, IdentifierType>::GetChangedComponents() const
+{
+	return changedComponents;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline const IdentifierType&
+ComponentDescriptorHeap<Frames, IdentifierType>::GetComponentIdentifier(
+	size_t componentSlot) const
+{
+	return componentOffsets[componentSlot].identifier;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void
+ComponentDescriptorHeap<Frames, IdentifierType>::UpdateComponentDescriptors(
+	size_t componentSlot, const ResourceComponent& component)
+{
+	auto& offsets = componentOffsets[componentSlot];
+
+	if (offsets.framesLeftToUpdate == 0)
+		return;
+
+	GrowHeapsIfRequired();
+	size_t heapStartCurrentFrame = GetRegionStart(offsets.dynamic);
+
+	if (!offsets.dynamic)
+	{
+		staticRegionRewritten = staticRegionRewritten || offsets.written;
+		offsets.written = true;
+	}
+
+	UINT nrOfDescriptors = std::min(offsets.nrOfDescriptors,
+		static_cast<UINT>(component.NrOfDescriptors()));
+	size_t cbvOffset = offsets.viewOffsets[static_cast<size_t>(ViewType::CBV)];
+	if (cbvOffset != size_t(-1))
+	{
+		StoreDescriptors(component.GetDescriptorHeapCBV(),
+			heapStartCurrentFrame + cbvOffset, nrOfDescriptors);
+	}
+
+	size_t srvOffset = offsets.viewOffsets[static_cast<size_t>(ViewType::SRV)];
+	if (srvOffset != size_t(-1))
+	{
+		StoreDescriptors(component.GetDescriptorHeapSRV(),
+			heapStartCurrentFrame + srvOffset, nrOfDescriptors);
+	}
+
+	size_t uavOffset = offsets.viewOffsets[static_cast<size_t>(ViewType::UAV)];
+	if (uavOffset != size_t(-1))
+	{
+		StoreDescriptors(component.GetDescriptorHeapUAV(),
+			heapStartCurrentFrame + uavOffset, nrOfDescriptors);
+	}
+
+	DescriptorRange updatedRange;
+	updatedRange.startOffset = heapStartCurrentFrame + offsets.startOffset;
+	updatedRange.nrOfDescriptors = offsets.totalDescriptors;
+	updatedRanges.push_back(updatedRange);
+	--offsets.framesLeftToUpdate;
 }
 
 template<FrameType Frames, typename IdentifierType>
 inline size_t
 ComponentDescriptorHeap<Frames, IdentifierType>::GetComponentHeapOffset(
-	const IdentifierType& identifier, ViewType viewType)
+	size_t componentSlot, ViewType viewType) const
+{
+	auto& offsets = componentOffsets[componentSlot];
+	size_t offset = offsets.viewOffsets[static_cast<size_t>(viewType)];
+
+	return offset == size_t(-1) ? offset :
+		offset + GetRegionStart(offsets.dynamic);
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline size_t
+ComponentDescriptorHeap<Frames, IdentifierType>::AllocateTransientDescriptors(
+	size_t nrOfDescriptors)
 {
-	auto& offsets = componentOffsets[identifier];
+	if (nrOfDescriptors == 0 || nrOfDescriptors > transientSize)
+		return size_t(-1);
 
-	switch (viewType)
+	size_t padding = 0;
+	if (transientHead + nrOfDescriptors > transientSize)
+		padding = transientSize - transientHead;
+
+	if (transientUsed + padding + nrOfDescriptors > transientSize)
+		return size_t(-1);
+
+	if (transientHead + padding == transientSize)
+		++transientWraps;
+
+	size_t toReturn = (transientHead + padding) % transientSize;
+	transientHead = toReturn + nrOfDescriptors;
+	transientUsed += padding + nrOfDescriptors;
+	transientAllocatedPerFrame[this->activeFrame] += padding + nrOfDescriptors;
+
+	return toReturn;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void
+ComponentDescriptorHeap<Frames, IdentifierType>::CopyToTransientDescriptors(
+	size_t heapOffset, D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle,
+	UINT nrOfDescriptors)
+{
+	StoreDescriptors(sourceHandle, heapOffset, nrOfDescriptors);
+
+	auto destinationHandle = gpuHeap->GetCPUDescriptorHandleForHeapStart();
+	destinationHandle.ptr += heapOffset * descriptorSize;
+	auto mirrorHandle = cpuHeap->GetCPUDescriptorHandleForHeapStart();
+	mirrorHandle.ptr += heapOffset * descriptorSize;
+	device->CopyDescriptorsSimple(nrOfDescriptors, destinationHandle,
+		mirrorHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline std::uint64_t
+ComponentDescriptorHeap<Frames, IdentifierType>::GetTransientWrapCount() const
+{
+	return transientWraps;
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline void ComponentDescriptorHeap<Frames, IdentifierType>::CopyUpdatedRanges()
+{
+	std::sort(updatedRanges.begin(), updatedRanges.end(),
+		[](const DescriptorRange& a, const DescriptorRange& b)
+		{
+			return a.startOffset < b.startOffset;
+		});
+
+	copyDestinations.clear();
+	copySources.clear();
+	copySizes.clear();
+	descriptorsCopiedLastUpload = 0;
+
+	size_t rangeStart = 0;
+	size_t rangeEnd = 0;
+	for (size_t i = 0; i <= updatedRanges.size(); ++i)
+	{
+		if (i < updatedRanges.size() && i != 0 &&
+			updatedRanges[i].startOffset <= rangeEnd)
+		{
+			rangeEnd = std::max(rangeEnd,
+				updatedRanges[i].startOffset + updatedRanges[i].nrOfDescriptors);
+			continue;
+		}
+
+		if (i != 0)
+		{
+			auto destination = gpuHeap->GetCPUDescriptorHandleForHeapStart();
+			destination.ptr += rangeStart * descriptorSize;
+			auto source = cpuHeap->GetCPUDescriptorHandleForHeapStart();
+			source.ptr += rangeStart * descriptorSize;
+			copyDestinations.push_back(destination);
+			copySources.push_back(source);
+			copySizes.push_back(static_cast<UINT>(rangeEnd - rangeStart));
+			descriptorsCopiedLastUpload += rangeEnd - rangeStart;
+		}
+
+		if (i < updatedRanges.size())
+		{
+			rangeStart = updatedRanges[i].startOffset;
+			rangeEnd = rangeStart + updatedRanges[i].nrOfDescriptors;
+		}
+	}
+
+	if (copySizes.size() != 0)
 	{
-	case ViewType::CBV:
-		return offsets.cbvOffset;
-	case ViewType::SRV:
-		return offsets.srvOffset;
-	case ViewType::UAV:
-		return offsets.uavOffset;
-	default:
-		throw std::runtime_error("Attempting to get heap offset of incorrect type");
+		UINT nrOfRanges = static_cast<UINT>(copySizes.size());
+		device->CopyDescriptors(nrOfRanges, copyDestinations.data(),
+			copySizes.data(), nrOfRanges, copySources.data(), copySizes.data(),
+			D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 	}
 }
 
@@ -148,11 +470,31 @@ template<FrameType Frames, typename IdentifierType>
 inline void
 ComponentDescriptorHeap<Frames, IdentifierType>::UploadCurrentFrameHeap()
 {
-	auto destination = gpuHeap->GetCPUDescriptorHandleForHeapStart();
-	destination.ptr += this->activeFrame * descriptorsPerFrame * descriptorSize;
-	auto source = cpuHeap->GetCPUDescriptorHandleForHeapStart();
-	device->CopyDescriptorsSimple(descriptorsPerFrame, destination, source,
-		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	GrowHeapsIfRequired();
+
+	if (staticRegionRewritten)
+	{
+		ReplaceShaderVisibleHeap();
+		descriptorsCopiedLastUpload = GetTotalDescriptors();
+	}
+	else
+	{
+		CopyUpdatedRanges();
+	}
+
+	updatedRanges.clear();
+	changedComponents.erase(std::remove_if(changedComponents.begin(),
+		changedComponents.end(), [this](size_t componentSlot)
+		{
+			return componentOffsets[componentSlot].framesLeftToUpdate == 0;
+		}), changedComponents.end());
+}
+
+template<FrameType Frames, typename IdentifierType>
+inline size_t
+ComponentDescriptorHeap<Frames, IdentifierType>::GetDescriptorsCopiedLastUpload() const
+{
+	return descriptorsCopiedLastUpload;
 }
 
 template<FrameType Frames, typename IdentifierType>
@@ -166,5 +508,16 @@ template<FrameType Frames, typename IdentifierType>
 inline void ComponentDescriptorHeap<Frames, IdentifierType>::SwapFrame()
 {
 	FrameBased<Frames>::SwapFrame();
-	currentOffset = 0;
+
+	transientUsed -= transientAllocatedPerFrame[this->activeFrame];
+	transientAllocatedPerFrame[this->activeFrame] = 0;
+
+	for (auto& retired : retiredHeaps)
+		--retired.framesLeft;
+
+	retiredHeaps.erase(std::remove_if(retiredHeaps.begin(), retiredHeaps.end(),
+		[](const RetiredHeap& retired)
+		{
+			return retired.framesLeft == 0;
+		}), retiredHeaps.end());
 }
@@ -0,0 +1,175 @@
+#include "ConcurrentDescriptorAllocator.h"
+
+#include <stdexcept>
+
+void DescriptorReservation::Release()
+{
+	if (owner != nullptr && rangeIndex != size_t(-1))
+		owner->ReleaseRange(rangeIndex);
+
+	owner = nullptr;
+	rangeIndex = size_t(-1);
+	nrOfDescriptors = 0;
+	nextFree = 0;
+}
+
+DescriptorReservation::~DescriptorReservation()
+{
+	Release();
+}
+
+DescriptorReservation::DescriptorReservation(
+	DescriptorReservation&& other) noexcept : owner(other.owner),
+	device(other.device), rangeIndex(other.rangeIndex),
+	heapStart(other.heapStart), nrOfDescriptors(other.nrOfDescriptors),
+	nextFree(other.nextFree), startHandle(other.startHandle),
+	descriptorSize(other.descriptorSize)
+{
+	other.owner = nullptr;
+	other.rangeIndex = size_t(-1);
+	other.nrOfDescriptors = 0;
+	other.nextFree = 0;
+}
+
+DescriptorReservation& DescriptorReservation::operator=(
+	DescriptorReservation&& other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+		owner = other.owner;
+		device = other.device;
+		rangeIndex = other.rangeIndex;
+		heapStart = other.heapStart;
+		nrOfDescriptors = other.nrOfDescriptors;
+		nextFree = other.nextFree;
+		startHandle = other.startHandle;
+		descriptorSize = other.descriptorSize;
+
+		other.owner = nullptr;
+		other.rangeIndex = size_t(-1);
+		other.nrOfDescriptors = 0;
+		other.nextFree = 0;
+	}
+
+	return *this;
+}
+
+bool DescriptorReservation::Valid() const
+{
+	return rangeIndex != size_t(-1);
+}
+
+size_t DescriptorReservation::AllocateDescriptor()
+{
+	if (nextFree == nrOfDescriptors)
+		return size_t(-1);
+
+	return heapStart + nextFree++;
+}
+
+size_t DescriptorReservation::CreateSRV(ID3D12Resource* resource,
+	const D3D12_SHADER_RESOURCE_VIEW_DESC* desc)
+{
+	size_t toReturn = AllocateDescriptor();
+
+	if (toReturn != size_t(-1))
+		device->CreateShaderResourceView(resource, desc, GetDescriptorHandle(toReturn));
+
+	return toReturn;
+}
+
+size_t DescriptorReservation::CreateUAV(ID3D12Resource* resource,
+	const D3D12_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D12Resource* counterResource)
+{
+	size_t toReturn = AllocateDescriptor();
+
+	if (toReturn != size_t(-1))
+	{
+		device->CreateUnorderedAccessView(resource, counterResource, desc,
+			GetDescriptorHandle(toReturn));
+	}
+
+	return toReturn;
+}
+
+size_t DescriptorReservation::CreateCBV(const D3D12_CONSTANT_BUFFER_VIEW_DESC* desc)
+{
+	size_t toReturn = AllocateDescriptor();
+
+	if (toReturn != size_t(-1))
+		device->CreateConstantBufferView(desc, GetDescriptorHandle(toReturn));
+
+	return toReturn;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE DescriptorReservation::GetDescriptorHandle(
+	size_t heapIndex) const
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE toReturn = startHandle;
+	toReturn.ptr += (heapIndex - heapStart) * descriptorSize;
+	return toReturn;
+}
+
+size_t DescriptorReservation::NrOfFreeDescriptors() const
+{
+	return nrOfDescriptors - nextFree;
+}
+
+void ConcurrentDescriptorAllocator::LockAllocator(
+	std::unique_lock<std::mutex>& lock)
+{
+	if (!lock.try_lock())
+	{
+		++contendedLocks;
+		lock.lock();
+	}
+}
+
+void ConcurrentDescriptorAllocator::ReleaseRange(size_t rangeIndex)
+{
+	std::unique_lock<std::mutex> lock(allocatorMutex, std::defer_lock);
+	LockAllocator(lock);
+	rangeAllocator.DeallocateRange(rangeIndex);
+}
+
+void ConcurrentDescriptorAllocator::Initialize(
+	D3D12_DESCRIPTOR_HEAP_TYPE descriptorType, ID3D12Device* deviceToUse,
+	size_t nrOfDescriptors)
+{
+	device = deviceToUse;
+	descriptorSize = device->GetDescriptorHandleIncrementSize(descriptorType);
+	rangeAllocator.Initialize(descriptorType, device, nrOfDescriptors);
+}
+
+DescriptorReservation ConcurrentDescriptorAllocator::Reserve(
+	size_t nrOfDescriptors)
+{
+	DescriptorReservation toReturn;
+	std::unique_lock<std::mutex> lock(allocatorMutex, std::defer_lock);
+	LockAllocator(lock);
+
+	size_t rangeIndex = rangeAllocator.AllocateRange(nrOfDescriptors);
+	if (rangeIndex == size_t(-1))
+		throw std::runtime_error("Could not reserve descriptors");
+
+	toReturn.owner = this;
+	toReturn.device = device;
+	toReturn.rangeIndex = rangeIndex;
+	toReturn.heapStart = rangeAllocator.GetHeapIndex(rangeIndex);
+	toReturn.nrOfDescriptors = nrOfDescriptors;
+	toReturn.startHandle = rangeAllocator.GetDescriptorHandle(rangeIndex);
+	toReturn.descriptorSize = descriptorSize;
+
+	return toReturn;
+}
+
+ID3D12DescriptorHeap* ConcurrentDescriptorAllocator::GetHeap() const
+{
+	return rangeAllocator.GetHeap();
+}
+
+size_t ConcurrentDescriptorAllocator::NrOfContendedLocks() const
+{
+	return contendedLocks;
+}
\ No newline at end of file
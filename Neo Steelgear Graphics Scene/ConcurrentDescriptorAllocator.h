@@ -0,0 +1,80 @@
+#pragma once
+
+#include <d3d12.h>
+#include <atomic>
+#include <mutex>
+
+#include "DescriptorRangeAllocator.h"
+
+class ConcurrentDescriptorAllocator;
+
+class DescriptorReservation
+{
+private:
+	friend class ConcurrentDescriptorAllocator;
+
+	ConcurrentDescriptorAllocator* owner = nullptr;
+	ID3D12Device* device = nullptr;
+	size_t rangeIndex = size_t(-1);
+	size_t heapStart = 0;
+	size_t nrOfDescriptors = 0;
+	size_t nextFree = 0;
+	D3D12_CPU_DESCRIPTOR_HANDLE startHandle = { 0 };
+	size_t descriptorSize = 0;
+
+	void Release();
+
+public:
+	DescriptorReservation() = default;
+	~DescriptorReservation();
+	DescriptorReservation(const DescriptorReservation& other) = delete;
+	DescriptorReservation& operator=(const DescriptorReservation& other) = delete;
+	DescriptorReservation(DescriptorReservation&& other) noexcept;
+	DescriptorReservation& operator=(DescriptorReservation&& other) noexcept;
+
+	bool Valid() const;
+	size_t AllocateDescriptor();
+
+	size_t CreateSRV(ID3D12Resource* resource,
+		const D3D12_SHADER_RESOURCE_VIEW_DESC* desc = nullptr);
+	size_t CreateUAV(ID3D12Resource* resource,
+		const D3D12_UNORDERED_ACCESS_VIEW_DESC* desc = nullptr,
+		ID3D12Resource* counterResource = nullptr);
+	size_t CreateCBV(const D3D12_CONSTANT_BUFFER_VIEW_DESC* desc);
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetDescriptorHandle(size_t heapIndex) const;
+	size_t NrOfFreeDescriptors() const;
+};
+
+class ConcurrentDescriptorAllocator
+{
+private:
+	friend class DescriptorReservation;
+
+	ID3D12Device* device = nullptr;
+	size_t descriptorSize = 0;
+	DescriptorRangeAllocator rangeAllocator;
+	std::mutex allocatorMutex;
+	std::atomic<size_t> contendedLocks{ 0 };
+
+	void LockAllocator(std::unique_lock<std::mutex>& lock);
+	void ReleaseRange(size_t rangeIndex);
+
+public:
+	ConcurrentDescriptorAllocator() = default;
+	~ConcurrentDescriptorAllocator() = default;
+	ConcurrentDescriptorAllocator(const ConcurrentDescriptorAllocator& other) = delete;
+	ConcurrentDescriptorAllocator& operator=(
+		const ConcurrentDescriptorAllocator& other) = delete;
+	ConcurrentDescriptorAllocator(ConcurrentDescriptorAllocator&& other) = delete;
+	ConcurrentDescriptorAllocator& operator=(
+		ConcurrentDescriptorAllocator&& other) = delete;
+
+	void Initialize(D3D12_DESCRIPTOR_HEAP_TYPE descriptorType,
+		ID3D12Device* deviceToUse, size_t nrOfDescriptors);
+
+	DescriptorReservation Reserve(size_t nrOfDescriptors);
+
+	ID3D12DescriptorHeap* GetHeap() const;
+	size_t NrOfContendedLocks() const;
+};
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "DescriptorCache.h"
+
+#include <stdexcept>
+
+bool DescriptorCache::DescriptorKey::operator==(const DescriptorKey& other) const
+{
+	return viewType == other.viewType && resource == other.resource &&
+		counterResource == other.counterResource && descBytes == other.descBytes;
+}
+
+size_t DescriptorCache::DescriptorKeyHash::operator()(
+	const DescriptorKey& key) const
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	auto hashBytes = [&hash](const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+	};
+
+	hashBytes(&key.viewType, sizeof(key.viewType));
+	hashBytes(&key.resource, sizeof(key.resource));
+	hashBytes(&key.counterResource, sizeof(key.counterResource));
+	hashBytes(key.descBytes.data(), key.descBytes.size());
+
+	return static_cast<size_t>(hash);
+}
+
+bool DescriptorCache::FindCached(const DescriptorKey& key, size_t& index)
+{
+	auto result = descriptorLookup.find(key);
+
+	if (result == descriptorLookup.end())
+	{
+		++cacheMisses;
+		return false;
+	}
+
+	index = result->second;
+	++cachedDescriptors[index].references;
+	++cacheHits;
+	return true;
+}
+
+size_t DescriptorCache::StoreAllocated(DescriptorKey&& key, size_t index)
+{
+	if (index == size_t(-1))
+		return index;
+
+	descriptorLookup[key] = index;
+	CachedDescriptor& cached = cachedDescriptors[index];
+	cached.key = std::move(key);
+	cached.references = 1;
+
+	return index;
+}
+
+void DescriptorCache::Initialize(D3D12_DESCRIPTOR_HEAP_TYPE descriptorType,
+	ID3D12Device* deviceToUse, size_t nrOfDescriptors)
+{
+	allocator.Initialize(descriptorType, deviceToUse, nrOfDescriptors);
+}
+
+size_t DescriptorCache::AllocateSRV(ID3D12Resource* resource,
+	D3D12_SHADER_RESOURCE_VIEW_DESC* desc)
+{
+	DescriptorKey key = CreateKey(ViewType::SRV, resource, desc);
+	size_t toReturn = size_t(-1);
+
+	if (FindCached(key, toReturn))
+		return toReturn;
+
+	return StoreAllocated(std::move(key), allocator.AllocateSRV(resource, desc));
+}
+
+size_t DescriptorCache::AllocateDSV(ID3D12Resource* resource,
+	D3D12_DEPTH_STENCIL_VIEW_DESC* desc)
+{
+	DescriptorKey key = CreateKey(ViewType::DSV, resource, desc);
+	size_t toReturn = size_t(-1);
+
+	if (FindCached(key, toReturn))
+		return toReturn;
+
+	return StoreAllocated(std::move(key), allocator.AllocateDSV(resource, desc));
+}
+
+size_t DescriptorCache::AllocateRTV(ID3D12Resource* resource,
+	D3D12_RENDER_TARGET_VIEW_DESC* desc)
+{
+	DescriptorKey key = CreateKey(ViewType::RTV, resource, desc);
+	size_t toReturn = size_t(-1);
+
+	if (FindCached(key, toReturn))
+		return toReturn;
+
+	return StoreAllocated(std::move(key), allocator.AllocateRTV(resource, desc));
+}
+
+size_t DescriptorCache::AllocateUAV(ID3D12Resource* resource,
+	D3D12_UNORDERED_ACCESS_VIEW_DESC* desc, ID3D12Resource* counterResource)
+{
+	DescriptorKey key = CreateKey(ViewType::UAV, resource, desc, counterResource);
+	size_t toReturn = size_t(-1);
+
+	if (FindCached(key, toReturn))
+		return toReturn;
+
+	return StoreAllocated(std::move(key),
+		allocator.AllocateUAV(resource, desc, counterResource));
+}
+
+size_t DescriptorCache::AllocateCBV(D3D12_CONSTANT_BUFFER_VIEW_DESC* desc)
+{
+	DescriptorKey key = CreateKey(ViewType::CBV, nullptr, desc);
+	size_t toReturn = size_t(-1);
+
+	if (FindCached(key, toReturn))
+		return toReturn;
+
+	return StoreAllocated(std::move(key), allocator.AllocateCBV(desc));
+}
+
+void DescriptorCache::ReleaseDescriptor(size_t index)
+{
+	auto result = cachedDescriptors.find(index);
+
+	if (result == cachedDescriptors.end())
+		throw std::runtime_error("Could not release descriptor that is not cached");
+
+	if (--result->second.references != 0)
+		return;
+
+	descriptorLookup.erase(result->second.key);
+	cachedDescriptors.erase(result);
+	allocator.DeallocateDescriptor(index);
+}
+
+const D3D12_CPU_DESCRIPTOR_HANDLE DescriptorCache::GetDescriptorHandle(
+	size_t index) const
+{
+	return allocator.GetDescriptorHandle(index);
+}
+
+size_t DescriptorCache::NrOfUniqueDescriptors() const
+{
+	return cachedDescriptors.size();
+}
+
+size_t DescriptorCache::NrOfCacheHits() const
+{
+	return cacheHits;
+}
+
+size_t DescriptorCache::NrOfCacheMisses() const
+{
+	return cacheMisses;
+}
\ No newline at end of file
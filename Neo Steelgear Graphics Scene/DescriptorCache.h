@@ -0,0 +1,95 @@
+#pragma once
+
+#include <d3d12.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "DescriptorAllocator.h"
+#include "ResourceComponent.h"
+
+class DescriptorCache
+{
+private:
+	struct DescriptorKey
+	{
+		ViewType viewType = ViewType::SRV;
+		ID3D12Resource* resource = nullptr;
+		ID3D12Resource* counterResource = nullptr;
+		std::string descBytes;
+
+		bool operator==(const DescriptorKey& other) const;
+	};
+
+	struct DescriptorKeyHash
+	{
+		size_t operator()(const DescriptorKey& key) const;
+	};
+
+	struct CachedDescriptor
+	{
+		DescriptorKey key;
+		size_t references = 0;
+	};
+
+	DescriptorAllocator allocator;
+	std::unordered_map<DescriptorKey, size_t, DescriptorKeyHash> descriptorLookup;
+	std::unordered_map<size_t, CachedDescriptor> cachedDescriptors;
+	size_t cacheHits = 0;
+	size_t cacheMisses = 0;
+
+	template<typename ViewDescType>
+	DescriptorKey CreateKey(ViewType viewType, ID3D12Resource* resource,
+		const ViewDescType* desc, ID3D12Resource* counterResource = nullptr);
+	bool FindCached(const DescriptorKey& key, size_t& index);
+	size_t StoreAllocated(DescriptorKey&& key, size_t index);
+
+public:
+	DescriptorCache() = default;
+	~DescriptorCache() = default;
+	DescriptorCache(const DescriptorCache& other) = delete;
+	DescriptorCache& operator=(const DescriptorCache& other) = delete;
+	DescriptorCache(DescriptorCache&& other) = default;
+	DescriptorCache& operator=(DescriptorCache&& other) = default;
+
+	void Initialize(D3D12_DESCRIPTOR_HEAP_TYPE descriptorType,
+		ID3D12Device* deviceToUse, size_t nrOfDescriptors);
+
+	size_t AllocateSRV(ID3D12Resource* resource,
+		D3D12_SHADER_RESOURCE_VIEW_DESC* desc = nullptr);
+	size_t AllocateDSV(ID3D12Resource* resource,
+		D3D12_DEPTH_STENCIL_VIEW_DESC* desc = nullptr);
+	size_t AllocateRTV(ID3D12Resource* resource,
+		D3D12_RENDER_TARGET_VIEW_DESC* desc = nullptr);
+	size_t AllocateUAV(ID3D12Resource* resource,
+		D3D12_UNORDERED_ACCESS_VIEW_DESC* desc = nullptr,
+		ID3D12Resource* counterResource = nullptr);
+	size_t AllocateCBV(D3D12_CONSTANT_BUFFER_VIEW_DESC* desc);
+
+	void ReleaseDescriptor(size_t index);
+
+	const D3D12_CPU_DESCRIPTOR_HANDLE GetDescriptorHandle(size_t index) const;
+
+	size_t NrOfUniqueDescriptors() const;
+	size_t NrOfCacheHits() const;
+	size_t NrOfCacheMisses() const;
+};
+
+template<typename ViewDescType>
+inline DescriptorCache::DescriptorKey DescriptorCache::CreateKey(
+	ViewType viewType, ID3D12Resource* resource, const ViewDescType* desc,
+	ID3D12Resource* counterResource)
+{
+	DescriptorKey toReturn;
+	toReturn.viewType = viewType;
+	toReturn.resource = resource;
+	toReturn.counterResource = counterResource;
+
+	if (desc != nullptr)
+	{
+		toReturn.descBytes.assign(reinterpret_cast<const char*>(desc),
+			sizeof(ViewDescType));
+	}
+
+	return toReturn;
+}
\ No newline at end of file
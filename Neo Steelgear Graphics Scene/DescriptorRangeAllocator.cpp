@@ -0,0 +1,90 @@
+#include "DescriptorRangeAllocator.h"
+
+#include <stdexcept>
+
+void DescriptorRangeAllocator::Initialize(
+	D3D12_DESCRIPTOR_HEAP_TYPE typeOfDescriptors, ID3D12Device* deviceToUse,
+	ID3D12DescriptorHeap* heapToUse, size_t startIndexInHeap,
+	size_t nrOfDescriptors)
+{
+	device = deviceToUse;
+	heap = heapToUse;
+	descriptorType = typeOfDescriptors;
+	descriptorSize = device->GetDescriptorHandleIncrementSize(descriptorType);
+	startIndex = startIndexInHeap;
+	ranges.Initialize(nrOfDescriptors);
+}
+
+void DescriptorRangeAllocator::Initialize(
+	D3D12_DESCRIPTOR_HEAP_TYPE typeOfDescriptors, ID3D12Device* deviceToUse,
+	size_t nrOfDescriptors)
+{
+	D3D12_DESCRIPTOR_HEAP_DESC desc;
+	desc.Type = typeOfDescriptors;
+	desc.NumDescriptors = static_cast<UINT>(nrOfDescriptors);
+	desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+	desc.NodeMask = 0;
+
+	HRESULT hr = deviceToUse->CreateDescriptorHeap(&desc,
+		IID_PPV_ARGS(&ownedHeap));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create descriptor range heap");
+
+	Initialize(typeOfDescriptors, deviceToUse, ownedHeap, 0, nrOfDescriptors);
+}
+
+size_t DescriptorRangeAllocator::AllocateRange(size_t nrOfDescriptors,
+	AllocationStrategy strategy)
+{
+	size_t toReturn = ranges.AllocateChunk(nrOfDescriptors, strategy, 1);
+
+	if (toReturn != size_t(-1))
+	{
+		ranges[toReturn].nrOfDescriptors = nrOfDescriptors;
+		descriptorsInUse += nrOfDescriptors;
+	}
+
+	return toReturn;
+}
+
+void DescriptorRangeAllocator::DeallocateRange(size_t rangeIndex)
+{
+	descriptorsInUse -= ranges[rangeIndex].nrOfDescriptors;
+	ranges.DeallocateChunk(rangeIndex);
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE DescriptorRangeAllocator::GetDescriptorHandle(
+	size_t rangeIndex, size_t offsetInRange) const
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE toReturn =
+		heap->GetCPUDescriptorHandleForHeapStart();
+	toReturn.ptr += (GetHeapIndex(rangeIndex) + offsetInRange) * descriptorSize;
+	return toReturn;
+}
+
+size_t DescriptorRangeAllocator::GetHeapIndex(size_t rangeIndex) const
+{
+	return startIndex + ranges.GetStartOfChunk(rangeIndex);
+}
+
+size_t DescriptorRangeAllocator::GetRangeSize(size_t rangeIndex) const
+{
+	return ranges[rangeIndex].nrOfDescriptors;
+}
+
+void DescriptorRangeAllocator::CopyRange(size_t rangeIndex,
+	D3D12_CPU_DESCRIPTOR_HANDLE destination)
+{
+	device->CopyDescriptorsSimple(static_cast<UINT>(GetRangeSize(rangeIndex)),
+		destination, GetDescriptorHandle(rangeIndex), descriptorType);
+}
+
+ID3D12DescriptorHeap* DescriptorRangeAllocator::GetHeap() const
+{
+	return heap;
+}
+
+size_t DescriptorRangeAllocator::NrOfDescriptorsInUse() const
+{
+	return descriptorsInUse;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <d3d12.h>
+
+#include "HeapHelper.h"
+#include "D3DPtr.h"
+
+class DescriptorRangeAllocator
+{
+private:
+	struct RangeData
+	{
+		size_t nrOfDescriptors = 0;
+	};
+
+	ID3D12Device* device = nullptr;
+	D3DPtr<ID3D12DescriptorHeap> ownedHeap;
+	ID3D12DescriptorHeap* heap = nullptr;
+	D3D12_DESCRIPTOR_HEAP_TYPE descriptorType =
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	size_t descriptorSize = 0;
+	size_t startIndex = 0;
+	HeapHelper<RangeData> ranges;
+	size_t descriptorsInUse = 0;
+
+public:
+	DescriptorRangeAllocator() = default;
+	~DescriptorRangeAllocator() = default;
+	DescriptorRangeAllocator(const DescriptorRangeAllocator& other) = delete;
+	DescriptorRangeAllocator& operator=(const DescriptorRangeAllocator& other) = delete;
+	DescriptorRangeAllocator(DescriptorRangeAllocator&& other) = default;
+	DescriptorRangeAllocator& operator=(DescriptorRangeAllocator&& other) = default;
+
+	void Initialize(D3D12_DESCRIPTOR_HEAP_TYPE typeOfDescriptors,
+		ID3D12Device* deviceToUse, ID3D12DescriptorHeap* heapToUse,
+		size_t startIndexInHeap, size_t nrOfDescriptors);
+	void Initialize(D3D12_DESCRIPTOR_HEAP_TYPE typeOfDescriptors,
+		ID3D12Device* deviceToUse, size_t nrOfDescriptors);
+
+	size_t AllocateRange(size_t nrOfDescriptors,
+		AllocationStrategy strategy = AllocationStrategy::FIRST_FIT);
+	void DeallocateRange(size_t rangeIndex);
+
+	D3D12_CPU_DESCRIPTOR_HANDLE GetDescriptorHandle(size_t rangeIndex,
+		size_t offsetInRange = 0) const;
+	size_t GetHeapIndex(size_t rangeIndex) const;
+	size_t GetRangeSize(size_t rangeIndex) const;
+
+	void CopyRange(size_t rangeIndex, D3D12_CPU_DESCRIPTOR_HANDLE destination);
+
+	ID3D12DescriptorHeap* GetHeap() const;
+	size_t NrOfDescriptorsInUse() const;
+};
\ No newline at end of file
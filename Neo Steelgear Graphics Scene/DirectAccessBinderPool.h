@@ -0,0 +1,203 @@
+#pragma once
+
+#include <d3d12.h>
+
+#include <array>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "FrameObject.h"
+#include "D3DPtr.h"
+#include "ResourceUploader.h"
+#include "DirectAccessComponentBinder.h"
+
+template<typename ComponentIndex, FrameType Frames>
+class DirectAccessBinderPool : public FrameBased<Frames>
+{
+private:
+	struct PooledBinder
+	{
+		DirectAccessComponentBinder<ComponentIndex, Frames>* binder = nullptr;
+		size_t offset = 0;
+	};
+
+	ID3D12Device* device = nullptr;
+	std::vector<PooledBinder> binders;
+	std::vector<std::uint32_t> indices;
+	size_t bufferSize = 0;
+	size_t usedSize = 0;
+	FrameObject<D3DPtr<ID3D12Resource>, Frames> indexBuffers;
+	std::array<D3D12_RESOURCE_STATES, Frames> indexBufferStates = {};
+
+	D3D12_RESOURCE_BARRIER CreateTransition(D3D12_RESOURCE_STATES newState,
+		D3D12_RESOURCE_BARRIER_FLAGS flag);
+
+	void CreateIndexBuffers();
+
+public:
+	DirectAccessBinderPool() = default;
+	~DirectAccessBinderPool() = default;
+	DirectAccessBinderPool(const DirectAccessBinderPool& other) = delete;
+	DirectAccessBinderPool& operator=(const DirectAccessBinderPool& other) = delete;
+	DirectAccessBinderPool(DirectAccessBinderPool&& other) = default;
+	DirectAccessBinderPool& operator=(DirectAccessBinderPool&& other) = default;
+
+	void Initialize(ID3D12Device* deviceToUse, size_t maxTotalBytes);
+
+	size_t AddBinder(DirectAccessComponentBinder<ComponentIndex, Frames>* binder);
+
+	// The active index buffer must be transitioned to copy dest before the
+	// upload and back to a shader resource after it
+	void UploadIndices(ResourceUploader* uploader,
+		ID3D12GraphicsCommandList* commandList);
+	D3D12_RESOURCE_BARRIER TransitionToCopyDest(
+		D3D12_RESOURCE_BARRIER_FLAGS flag = D3D12_RESOURCE_BARRIER_FLAG_NONE);
+	D3D12_RESOURCE_BARRIER TransitionToShaderResource(
+		D3D12_RESOURCE_BARRIER_FLAGS flag = D3D12_RESOURCE_BARRIER_FLAG_NONE);
+
+	D3D12_GPU_VIRTUAL_ADDRESS GetBufferAdress(size_t binderOffset);
+
+	void SwapFrame() override;
+};
+
+template<typename ComponentIndex, FrameType Frames>
+inline void DirectAccessBinderPool<ComponentIndex, Frames>::CreateIndexBuffers()
+{
+	D3D12_HEAP_PROPERTIES heapProperties;
+	ZeroMemory(&heapProperties, sizeof(heapProperties));
+	heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+	D3D12_RESOURCE_DESC desc;
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	desc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+	desc.Width = bufferSize;
+	desc.Height = 1;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.Format = DXGI_FORMAT_UNKNOWN;
+	desc.SampleDesc.Count = 1;
+	desc.SampleDesc.Quality = 0;
+	desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+	std::function<void(D3DPtr<ID3D12Resource>&)> initFunc =
+		[&](D3DPtr<ID3D12Resource>& resource)
+	{
+		HRESULT hr = device->CreateCommittedResource(&heapProperties,
+			D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr,
+			IID_PPV_ARGS(&resource));
+
+		if (FAILED(hr))
+			throw std::runtime_error("Could not create pooled component index buffer");
+	};
+
+	indexBuffers.Initialize(initFunc);
+	indexBufferStates.fill(D3D12_RESOURCE_STATE_COMMON);
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_RESOURCE_BARRIER
+DirectAccessBinderPool<ComponentIndex, Frames>::CreateTransition(
+	D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_BARRIER_FLAGS flag)
+{
+	D3D12_RESOURCE_STATES& currentState = indexBufferStates[this->activeFrame];
+
+	D3D12_RESOURCE_BARRIER toReturn;
+	toReturn.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+	toReturn.Flags = flag;
+	toReturn.Transition.pResource = indexBuffers.Active();
+	toReturn.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+	toReturn.Transition.StateBefore = currentState;
+	toReturn.Transition.StateAfter = newState;
+	currentState = newState;
+
+	return toReturn;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline void DirectAccessBinderPool<ComponentIndex, Frames>::Initialize(
+	ID3D12Device* deviceToUse, size_t maxTotalBytes)
+{
+	device = deviceToUse;
+	bufferSize = ((maxTotalBytes + 255) / 256) * 256;
+	indices.resize(bufferSize / sizeof(std::uint32_t));
+	CreateIndexBuffers();
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline size_t DirectAccessBinderPool<ComponentIndex, Frames>::AddBinder(
+	DirectAccessComponentBinder<ComponentIndex, Frames>* binder)
+{
+	if (!binder->UsesExternalIndexBuffer())
+		throw std::runtime_error("Pooled binders must be initialized to use an external index buffer");
+
+	size_t tableSize = binder->GetIndices().size() * sizeof(std::uint32_t);
+	tableSize = ((tableSize + 255) / 256) * 256;
+
+	if (usedSize + tableSize > bufferSize)
+		throw std::runtime_error("Direct access binder pool is full");
+
+	PooledBinder toStore;
+	toStore.binder = binder;
+	toStore.offset = usedSize;
+	binders.push_back(toStore);
+	usedSize += tableSize;
+
+	return toStore.offset;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline void DirectAccessBinderPool<ComponentIndex, Frames>::UploadIndices(
+	ResourceUploader* uploader, ID3D12GraphicsCommandList* commandList)
+{
+	if (usedSize == 0)
+		return;
+
+	for (auto& pooledBinder : binders)
+	{
+		auto& binderIndices = pooledBinder.binder->GetIndices();
+		std::memcpy(&indices[pooledBinder.offset / sizeof(std::uint32_t)],
+			binderIndices.data(), binderIndices.size() * sizeof(std::uint32_t));
+	}
+
+	if (!uploader->UploadBufferResourceData(indexBuffers.Active(), commandList,
+		indices.data(), 0, usedSize, alignof(std::uint32_t)))
+	{
+		throw std::runtime_error("Could not upload to pooled component index buffer");
+	}
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_RESOURCE_BARRIER
+DirectAccessBinderPool<ComponentIndex, Frames>::TransitionToCopyDest(
+	D3D12_RESOURCE_BARRIER_FLAGS flag)
+{
+	return CreateTransition(D3D12_RESOURCE_STATE_COPY_DEST, flag);
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_RESOURCE_BARRIER
+DirectAccessBinderPool<ComponentIndex, Frames>::TransitionToShaderResource(
+	D3D12_RESOURCE_BARRIER_FLAGS flag)
+{
+	return CreateTransition(D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER |
+		D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE |
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, flag);
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_GPU_VIRTUAL_ADDRESS
+DirectAccessBinderPool<ComponentIndex, Frames>::GetBufferAdress(
+	size_t binderOffset)
+{
+	return indexBuffers.Active()->GetGPUVirtualAddress() + binderOffset;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline void DirectAccessBinderPool<ComponentIndex, Frames>::SwapFrame()
+{
+	FrameBased<Frames>::SwapFrame();
+	indexBuffers.SwapFrame();
+}
\ No newline at end of file
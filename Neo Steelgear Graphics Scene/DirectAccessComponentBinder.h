@@ -6,6 +6,9 @@
 #include <stdexcept>
 #include <cstdint>
 #include <cmath>
+#include <array>
+#include <memory>
+#include <vector>
 
 #include "FrameObject.h"
 #include "D3DPtr.h"
@@ -25,6 +28,15 @@ public:
 	};
 
 private:
+	struct BindState
+	{
+		ID3D12DescriptorHeap* heap = nullptr;
+		size_t heapStartOffset = size_t(-1);
+		std::uint64_t heapEpoch = 0;
+		std::vector<SIZE_T> sources;
+		std::vector<std::uint64_t> generations;
+	};
+
 	ID3D12Device* device = nullptr;
 	std::vector<ComponentToBind> componentsToBind;
 	std::vector<std::uint32_t> indices;
@@ -33,9 +45,16 @@ private:
 	size_t descriptorSize = 0;
 	FrameObject<D3DPtr<ID3D12Resource>, Frames> componentIndexBuffer;
 	D3D12_RESOURCE_STATES resourceState = D3D12_RESOURCE_STATE_COMMON;
+	bool useRootConstants = false;
+	bool externalIndexBuffer = false;
+	std::array<BindState, Frames> lastBinds;
+	std::vector<SIZE_T> currentSources;
+	std::vector<std::uint64_t> currentGenerations;
+	size_t skippedBinds = 0;
 
 	void CreateComponentIndexBuffer();
 	void CreateDescriptorHeap();
+	ID3D12Resource* GetIndexBuffer();
 
 	D3D12_CPU_DESCRIPTOR_HANDLE GetDescriptorHeap(ResourceComponent* component,
 		ViewType type);
@@ -50,13 +69,20 @@ public:
 	DirectAccessComponentBinder& operator=(DirectAccessComponentBinder&& other);
 
 	void Initialize(ID3D12Device* deviceToUse, size_t shaderBindDescriptorSize,
-		const std::vector<ComponentToBind>& toBind);
+		const std::vector<ComponentToBind>& toBind, size_t rootConstantBudget = 0,
+		bool useExternalIndexBuffer = false);
 
 	~DirectAccessComponentBinder();
 
+	// Binds into the transient descriptor ring must pass its wrap count as the
+	// heap epoch, a wrapped ring may have overwritten the previous bind
+	template<typename Allocator = std::allocator<ResourceComponent*>>
 	void BindComponents(ResourceUploader* uploader, 
 		ID3D12GraphicsCommandList* commandList, ID3D12DescriptorHeap* toCopyTo,
-		size_t heapStartOffset, const std::vector<ResourceComponent*>& components);
+		size_t heapStartOffset,
+		const std::vector<ResourceComponent*, Allocator>& components,
+		const std::vector<std::uint64_t>* componentGenerations = nullptr,
+		std::uint64_t heapEpoch = 0);
 
 	D3D12_RESOURCE_BARRIER TransitionToCopyDest(
 		D3D12_RESOURCE_BARRIER_FLAGS flag = D3D12_RESOURCE_BARRIER_FLAG_NONE);
@@ -65,6 +91,15 @@ public:
 
 	D3D12_GPU_VIRTUAL_ADDRESS GetBufferAdress();
 
+	bool UsesRootConstants() const;
+	bool UsesExternalIndexBuffer() const;
+	const std::vector<std::uint32_t>& GetIndices() const;
+	void SetGraphicsRootConstants(ID3D12GraphicsCommandList* commandList,
+		UINT rootParameterIndex);
+
+	void InvalidateCachedBinds();
+	size_t GetNrOfSkippedBinds() const;
+
 	void SwapFrame() override;
 };
 
@@ -119,6 +154,16 @@ DirectAccessComponentBinder<ComponentIndex, Frames>::CreateDescriptorHeap()
 		throw std::runtime_error("Could not create direct access binder cpu heap");
 }
 
+template<typename ComponentIndex, FrameType Frames>
+inline ID3D12Resource*
+DirectAccessComponentBinder<ComponentIndex, Frames>::GetIndexBuffer()
+{
+	if (componentIndexBuffer.Active() == nullptr)
+		throw std::runtime_error("Direct access binder does not own an index buffer");
+
+	return componentIndexBuffer.Active();
+}
+
 template<typename ComponentIndex, FrameType Frames>
 inline D3D12_CPU_DESCRIPTOR_HANDLE 
 DirectAccessComponentBinder<ComponentIndex, Frames>::GetDescriptorHeap(
@@ -150,7 +195,10 @@ DirectAccessComponentBinder<ComponentIndex, Frames>::DirectAccessComponentBinder
 	descriptorsInHeap(other.descriptorsInHeap), 
 	descriptorSize(other.descriptorSize), 
 	componentIndexBuffer(std::move(other.componentIndexBuffer)), 
-	resourceState(other.resourceState)
+	resourceState(other.resourceState), useRootConstants(other.useRootConstants),
+	externalIndexBuffer(other.externalIndexBuffer),
+	lastBinds(std::move(other.lastBinds)),
+	skippedBinds(other.skippedBinds)
 {
 	other.device = nullptr;
 	other.descriptorsInHeap = 0;
@@ -178,6 +226,10 @@ DirectAccessComponentBinder<ComponentIndex, Frames>::operator=(
 		descriptorSize = other.descriptorSize;
 		componentIndexBuffer = std::move(other.componentIndexBuffer);
 		resourceState = other.resourceState;
+		useRootConstants = other.useRootConstants;
+		externalIndexBuffer = other.externalIndexBuffer;
+		lastBinds = std::move(other.lastBinds);
+		skippedBinds = other.skippedBinds;
 
 		other.device = nullptr;
 		other.descriptorsInHeap = 0;
@@ -196,7 +248,8 @@ DirectAccessComponentBinder<ComponentIndex, Frames>::operator=(
 template<typename ComponentIndex, FrameType Frames>
 inline void DirectAccessComponentBinder<ComponentIndex, Frames>::Initialize(
 	ID3D12Device* deviceToUse, size_t shaderBindDescriptorSize,
-	const std::vector<ComponentToBind>& toBind)
+	const std::vector<ComponentToBind>& toBind, size_t rootConstantBudget,
+	bool useExternalIndexBuffer)
 {
 	device = deviceToUse;
 	descriptorSize = shaderBindDescriptorSize;
@@ -205,6 +258,16 @@ inline void DirectAccessComponentBinder<ComponentIndex, Frames>::Initialize(
 	for (auto& componentToBind : componentsToBind)
 		descriptorsInHeap += componentToBind.maxComponents;
 
+	useRootConstants = rootConstantBudget != 0 &&
+		componentsToBind.size() <= rootConstantBudget;
+	externalIndexBuffer = !useRootConstants && useExternalIndexBuffer;
+	if (useRootConstants || externalIndexBuffer)
+	{
+		indices.resize(componentsToBind.size());
+		CreateDescriptorHeap();
+		return;
+	}
+
 	size_t totalSize = componentsToBind.size() * sizeof(std::uint32_t);
 	totalSize = static_cast<size_t>(std::ceil((1.0 * totalSize) / 256) * 256);
 	totalSize /= sizeof(std::uint32_t);
@@ -226,25 +289,53 @@ DirectAccessComponentBinder<ComponentIndex, Frames>::~DirectAccessComponentBinde
 }
 
 template<typename ComponentIndex, FrameType Frames>
+template<typename Allocator>
 inline void DirectAccessComponentBinder<ComponentIndex, Frames>::BindComponents(
 	ResourceUploader* uploader, ID3D12GraphicsCommandList* commandList,
 	ID3D12DescriptorHeap* toCopyTo, size_t heapStartOffset,
-	const std::vector<ResourceComponent*>& components)
+	const std::vector<ResourceComponent*, Allocator>& components,
+	const std::vector<std::uint64_t>* componentGenerations, std::uint64_t heapEpoch)
 {
-	auto start = cpuHeap->GetCPUDescriptorHandleForHeapStart();
+	currentSources.resize(componentsToBind.size());
+	currentGenerations.resize(componentGenerations != nullptr ?
+		componentsToBind.size() : 0);
 	size_t currentOffset = 0;
+	for (size_t i = 0; i < componentsToBind.size(); ++i)
+	{
+		ResourceComponent* component = components[componentsToBind[i].index];
+		currentSources[i] = GetDescriptorHeap(component,
+			componentsToBind[i].viewType).ptr;
+
+		if (componentGenerations != nullptr)
+			currentGenerations[i] = (*componentGenerations)[componentsToBind[i].index];
+
+		indices[i] = static_cast<std::uint32_t>(currentOffset + heapStartOffset / descriptorSize);
+		currentOffset += componentsToBind[i].maxComponents;
+	}
+
+	BindState& lastBind = lastBinds[this->activeFrame];
+	if (componentGenerations != nullptr && lastBind.heap == toCopyTo &&
+		lastBind.heapStartOffset == heapStartOffset &&
+		lastBind.heapEpoch == heapEpoch &&
+		lastBind.sources == currentSources &&
+		lastBind.generations == currentGenerations)
+	{
+		++skippedBinds;
+		return;
+	}
+
+	auto start = cpuHeap->GetCPUDescriptorHandleForHeapStart();
+	currentOffset = 0;
 
 	for (size_t i = 0; i < componentsToBind.size(); ++i)
 	{
 		D3D12_CPU_DESCRIPTOR_HANDLE destination = start;
 		destination.ptr += currentOffset * descriptorSize;
-		ResourceComponent* component = components[componentsToBind[i].index];
-		auto source = GetDescriptorHeap(component, componentsToBind[i].viewType);
+		D3D12_CPU_DESCRIPTOR_HANDLE source = { currentSources[i] };
 
 		device->CopyDescriptorsSimple(componentsToBind[i].maxComponents,
 			destination, source, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-		indices[i] = static_cast<std::uint32_t>(currentOffset + heapStartOffset / descriptorSize);
 		currentOffset += componentsToBind[i].maxComponents;
 	}
 
@@ -254,6 +345,15 @@ inline void DirectAccessComponentBinder<ComponentIndex, Frames>::BindComponents(
 		cpuHeap->GetCPUDescriptorHandleForHeapStart(),
 		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
+	lastBind.heap = toCopyTo;
+	lastBind.heapStartOffset = heapStartOffset;
+	lastBind.heapEpoch = heapEpoch;
+	lastBind.sources = currentSources;
+	lastBind.generations = currentGenerations;
+
+	if (useRootConstants || externalIndexBuffer)
+		return;
+
 	size_t chunk = uploader->UploadBufferResourceData(
 		componentIndexBuffer.Active(), commandList, &indices[0], 0,
 		sizeof(std::uint32_t) * indices.size(), alignof(std::uint32_t));
@@ -262,11 +362,93 @@ inline void DirectAccessComponentBinder<ComponentIndex, Frames>::BindComponents(
 		throw std::runtime_error("Could not upload to component index buffer");
 }
 
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_RESOURCE_BARRIER
+DirectAccessComponentBinder<ComponentIndex, Frames>::TransitionToCopyDest(
+	D3D12_RESOURCE_BARRIER_FLAGS flag)
+{
+	D3D12_RESOURCE_BARRIER toReturn;
+	toReturn.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+	toReturn.Flags = flag;
+	toReturn.Transition.pResource = GetIndexBuffer();
+	toReturn.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+	toReturn.Transition.StateBefore =
+		D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER |
+		D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE |
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+	toReturn.Transition.StateAfter = D3D12_RESOURCE_STATE_COPY_DEST;
+
+	return toReturn;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline D3D12_RESOURCE_BARRIER
+DirectAccessComponentBinder<ComponentIndex, Frames>::TransitionToShaderResource(
+	D3D12_RESOURCE_BARRIER_FLAGS flag)
+{
+	D3D12_RESOURCE_BARRIER toReturn;
+	toReturn.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+	toReturn.Flags = flag;
+	toReturn.Transition.pResource = GetIndexBuffer();
+	toReturn.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+	toReturn.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
+	toReturn.Transition.StateAfter =
+		D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER |
+		D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE |
+		D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+
+	return toReturn;
+}
+
 template<typename ComponentIndex, FrameType Frames>
 inline D3D12_GPU_VIRTUAL_ADDRESS 
 DirectAccessComponentBinder<ComponentIndex, Frames>::GetBufferAdress()
 {
-	return componentIndexBuffer.Active()->GetGPUVirtualAddress();
+	return GetIndexBuffer()->GetGPUVirtualAddress();
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline bool
+DirectAccessComponentBinder<ComponentIndex, Frames>::UsesRootConstants() const
+{
+	return useRootConstants;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline bool
+DirectAccessComponentBinder<ComponentIndex, Frames>::UsesExternalIndexBuffer() const
+{
+	return externalIndexBuffer;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline const std::vector<std::uint32_t>&
+DirectAccessComponentBinder<ComponentIndex, Frames>::GetIndices() const
+{
+	return indices;
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline void
+DirectAccessComponentBinder<ComponentIndex, Frames>::SetGraphicsRootConstants(
+	ID3D12GraphicsCommandList* commandList, UINT rootParameterIndex)
+{
+	commandList->SetGraphicsRoot32BitConstants(rootParameterIndex,
+		static_cast<UINT>(indices.size()), indices.data(), 0);
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline void DirectAccessComponentBinder<ComponentIndex, Frames>::InvalidateCachedBinds()
+{
+	for (auto& lastBind : lastBinds)
+		lastBind = BindState();
+}
+
+template<typename ComponentIndex, FrameType Frames>
+inline size_t 
+DirectAccessComponentBinder<ComponentIndex, Frames>::GetNrOfSkippedBinds() const
+{
+	return skippedBinds;
 }
 
 template<typename ComponentIndex, FrameType Frames>
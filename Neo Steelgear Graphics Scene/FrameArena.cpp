@@ -0,0 +1,50 @@
+#include "FrameArena.h"
+
+void LinearArena::Initialize(size_t initialCapacity)
+{
+	capacity = initialCapacity;
+	memory = std::make_unique<unsigned char[]>(capacity);
+	offset = 0;
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+	size_t alignedOffset = ((offset + alignment - 1) / alignment) * alignment;
+
+	if (alignedOffset + size <= capacity)
+	{
+		offset = alignedOffset + size;
+		return memory.get() + alignedOffset;
+	}
+
+	overflowBlocks.push_back(std::make_unique<unsigned char[]>(size + alignment));
+	overflowBytes += size + alignment;
+	unsigned char* block = overflowBlocks.back().get();
+	size_t blockAddress = reinterpret_cast<size_t>(block);
+	size_t alignedAddress = ((blockAddress + alignment - 1) / alignment) * alignment;
+
+	return block + (alignedAddress - blockAddress);
+}
+
+void LinearArena::Reset()
+{
+	if (overflowBytes != 0)
+	{
+		capacity = (capacity + overflowBytes) * 2;
+		memory = std::make_unique<unsigned char[]>(capacity);
+		overflowBlocks.clear();
+		overflowBytes = 0;
+	}
+
+	offset = 0;
+}
+
+size_t LinearArena::GetCapacity() const
+{
+	return capacity;
+}
+
+size_t LinearArena::GetUsedBytes() const
+{
+	return offset + overflowBytes;
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "FrameBased.h"
+
+class LinearArena
+{
+private:
+	std::unique_ptr<unsigned char[]> memory;
+	size_t capacity = 0;
+	size_t offset = 0;
+	std::vector<std::unique_ptr<unsigned char[]>> overflowBlocks;
+	size_t overflowBytes = 0;
+
+public:
+	LinearArena() = default;
+	~LinearArena() = default;
+	LinearArena(const LinearArena& other) = delete;
+	LinearArena& operator=(const LinearArena& other) = delete;
+	LinearArena(LinearArena&& other) = default;
+	LinearArena& operator=(LinearArena&& other) = default;
+
+	void Initialize(size_t initialCapacity);
+
+	void* Allocate(size_t size, size_t alignment);
+	void Reset();
+
+	size_t GetCapacity() const;
+	size_t GetUsedBytes() const;
+};
+
+template<typename T>
+class ArenaAllocator
+{
+private:
+	template<typename U>
+	friend class ArenaAllocator;
+
+	LinearArena* arena = nullptr;
+
+public:
+	typedef T value_type;
+
+	ArenaAllocator(LinearArena* arenaToUse) : arena(arenaToUse)
+	{
+		// EMPTY
+	}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena)
+	{
+		// EMPTY
+	}
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, size_t)
+	{
+		// EMPTY
+	}
+
+	template<typename U>
+	bool operator==(const ArenaAllocator<U>& other) const
+	{
+		return arena == other.arena;
+	}
+
+	template<typename U>
+	bool operator!=(const ArenaAllocator<U>& other) const
+	{
+		return arena != other.arena;
+	}
+};
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template<FrameType Frames>
+class FrameArena : public FrameBased<Frames>
+{
+private:
+	std::vector<LinearArena> arenas;
+	size_t nrOfThreads = 0;
+
+public:
+	FrameArena() = default;
+	~FrameArena() = default;
+	FrameArena(const FrameArena& other) = delete;
+	FrameArena& operator=(const FrameArena& other) = delete;
+	FrameArena(FrameArena&& other) = default;
+	FrameArena& operator=(FrameArena&& other) = default;
+
+	void Initialize(size_t threads, size_t initialCapacityPerArena);
+
+	LinearArena& GetArena(size_t threadIndex = 0);
+
+	template<typename T>
+	ArenaAllocator<T> GetAllocator(size_t threadIndex = 0);
+
+	void SwapFrame() override;
+};
+
+template<FrameType Frames>
+inline void FrameArena<Frames>::Initialize(size_t threads,
+	size_t initialCapacityPerArena)
+{
+	nrOfThreads = threads;
+	arenas.resize(Frames * nrOfThreads);
+
+	for (auto& arena : arenas)
+		arena.Initialize(initialCapacityPerArena);
+}
+
+template<FrameType Frames>
+inline LinearArena& FrameArena<Frames>::GetArena(size_t threadIndex)
+{
+	return arenas[this->activeFrame * nrOfThreads + threadIndex];
+}
+
+template<FrameType Frames>
+template<typename T>
+inline ArenaAllocator<T> FrameArena<Frames>::GetAllocator(size_t threadIndex)
+{
+	return ArenaAllocator<T>(&GetArena(threadIndex));
+}
+
+template<FrameType Frames>
+inline void FrameArena<Frames>::SwapFrame()
+{
+	FrameBased<Frames>::SwapFrame();
+
+	for (size_t i = 0; i < nrOfThreads; ++i)
+		GetArena(i).Reset();
+}
\ No newline at end of file
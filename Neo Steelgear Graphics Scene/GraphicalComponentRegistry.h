@@ -1,11 +1,48 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
 
 #include "ResourceComponent.h"
 
 typedef size_t GraphicalEntityIndex;
 
+struct EntityRemap
+{
+	GraphicalEntityIndex oldIndex;
+	GraphicalEntityIndex newIndex;
+};
+
+inline std::uint64_t SpreadMortonBits(std::uint64_t value)
+{
+	value &= 0x1fffff;
+	value = (value | value << 32) & 0x1f00000000ffff;
+	value = (value | value << 16) & 0x1f0000ff0000ff;
+	value = (value | value << 8) & 0x100f00f00f00f00f;
+	value = (value | value << 4) & 0x10c30c30c30c30c3;
+	value = (value | value << 2) & 0x1249249249249249;
+	return value;
+}
+
+inline std::uint64_t CalculateMortonKey(const float position[3],
+	const float sceneMin[3], const float sceneMax[3])
+{
+	std::uint64_t quantized[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		float extent = sceneMax[i] - sceneMin[i];
+		float normalized = extent > 0.0f ? 
+			(position[i] - sceneMin[i]) / extent : 0.0f;
+		normalized = std::min(std::max(normalized, 0.0f), 1.0f);
+		quantized[i] = static_cast<std::uint64_t>(normalized * 0x1fffff);
+	}
+
+	return SpreadMortonBits(quantized[0]) | (SpreadMortonBits(quantized[1]) << 1)
+		| (SpreadMortonBits(quantized[2]) << 2);
+}
+
 template<typename ComponentIndex>
 class GraphicalComponentRegistry
 {
@@ -14,6 +51,19 @@ private:
 	size_t firstFreeEntityIndex = size_t(-1);
 	std::vector<ResourceIndex> componentIndices;
 
+	std::vector<GraphicalEntityIndex> reorderSlots;
+	std::vector<GraphicalEntityIndex> reorderOrder;
+	std::vector<GraphicalEntityIndex> entityPositions;
+	std::vector<GraphicalEntityIndex> slotOccupants;
+	std::vector<GraphicalEntityIndex> movedEntities;
+	std::vector<bool> entityMoved;
+	size_t reorderProgress = 0;
+
+	void SwapEntities(const GraphicalEntityIndex& first,
+		const GraphicalEntityIndex& second);
+	void CancelReorder();
+	void RemoveFromReorder(const GraphicalEntityIndex& index);
+
 public:
 	GraphicalComponentRegistry() = default;
 	~GraphicalComponentRegistry() = default;
@@ -30,6 +80,13 @@ public:
 		const ComponentIndex& componentIndex) const;
 	void ClearResourceIndex(const GraphicalEntityIndex& entityIndex,
 		const ComponentIndex& componentIndex);
+
+	void BeginReorder(
+		const std::function<std::uint64_t(const GraphicalEntityIndex&)>& sortKey);
+	template<typename Allocator = std::allocator<EntityRemap>>
+	void ContinueReorder(size_t maxEntitiesToMove,
+		std::vector<EntityRemap, Allocator>& remaps);
+	bool ReorderInProgress() const;
 };
 
 template<typename ComponentIndex>
@@ -65,6 +122,7 @@ template<typename ComponentIndex>
 inline void GraphicalComponentRegistry<ComponentIndex>::RemoveEntity(
 	const GraphicalEntityIndex& index)
 {
+	RemoveFromReorder(index);
 	componentIndices[index] = firstFreeEntityIndex;
 	firstFreeEntityIndex = index;
 }
@@ -90,3 +148,158 @@ inline void GraphicalComponentRegistry<ComponentIndex>::ClearResourceIndex(
 {
 	componentIndices[entityIndex + componentIndex] = ResourceIndex(-1);
 }
+
+
+template<typename ComponentIndex>
+inline void GraphicalComponentRegistry<ComponentIndex>::SwapEntities(
+	const GraphicalEntityIndex& first, const GraphicalEntityIndex& second)
+{
+	std::swap_ranges(componentIndices.begin() + first,
+		componentIndices.begin() + first + componentsPerEntity,
+		componentIndices.begin() + second);
+}
+
+template<typename ComponentIndex>
+inline void GraphicalComponentRegistry<ComponentIndex>::CancelReorder()
+{
+	reorderSlots.clear();
+	reorderOrder.clear();
+	reorderProgress = 0;
+}
+
+template<typename ComponentIndex>
+inline void GraphicalComponentRegistry<ComponentIndex>::RemoveFromReorder(
+	const GraphicalEntityIndex& index)
+{
+	// New entities are placed outside of the reordered slots and are simply
+	// left where they are, but an unplaced entity that is removed must give up
+	// both its place in the order and the slot it currently occupies
+	if (!ReorderInProgress() || index / componentsPerEntity >= slotOccupants.size())
+		return;
+
+	GraphicalEntityIndex entity = slotOccupants[index / componentsPerEntity];
+	auto orderPosition = std::find(reorderOrder.begin() + reorderProgress,
+		reorderOrder.end(), entity);
+	if (orderPosition == reorderOrder.end())
+		return;
+
+	auto slotPosition = std::lower_bound(reorderSlots.begin() + reorderProgress,
+		reorderSlots.end(), index);
+	reorderOrder.erase(orderPosition);
+	reorderSlots.erase(slotPosition);
+
+	if (reorderProgress == reorderSlots.size())
+		CancelReorder();
+}
+
+template<typename ComponentIndex>
+inline void GraphicalComponentRegistry<ComponentIndex>::BeginReorder(
+	const std::function<std::uint64_t(const GraphicalEntityIndex&)>& sortKey)
+{
+	CancelReorder();
+
+	if (componentsPerEntity == 0)
+		return;
+
+	size_t nrOfEntities = componentIndices.size() / componentsPerEntity;
+	std::vector<bool> freeEntities(nrOfEntities, false);
+	for (size_t current = firstFreeEntityIndex; current != size_t(-1);
+		current = componentIndices[current])
+	{
+		freeEntities[current / componentsPerEntity] = true;
+	}
+
+	for (size_t i = 0; i < nrOfEntities; ++i)
+	{
+		if (!freeEntities[i])
+			reorderSlots.push_back(i * componentsPerEntity);
+	}
+
+	std::vector<std::pair<std::uint64_t, GraphicalEntityIndex>> keys;
+	keys.reserve(reorderSlots.size());
+	for (auto& slot : reorderSlots)
+		keys.push_back({ sortKey(slot), slot });
+
+	std::stable_sort(keys.begin(), keys.end(),
+		[](const auto& first, const auto& second)
+		{
+			return first.first < second.first;
+		});
+
+	reorderOrder.reserve(keys.size());
+	for (auto& key : keys)
+		reorderOrder.push_back(key.second);
+
+	entityPositions.resize(nrOfEntities);
+	slotOccupants.resize(nrOfEntities);
+	entityMoved.assign(nrOfEntities, false);
+	for (size_t i = 0; i < nrOfEntities; ++i)
+	{
+		entityPositions[i] = i * componentsPerEntity;
+		slotOccupants[i] = i * componentsPerEntity;
+	}
+}
+
+template<typename ComponentIndex>
+template<typename Allocator>
+inline void GraphicalComponentRegistry<ComponentIndex>::ContinueReorder(
+	size_t maxEntitiesToMove, std::vector<EntityRemap, Allocator>& remaps)
+{
+	remaps.clear();
+	movedEntities.clear();
+	size_t nrOfSwaps = 0;
+
+	// Entities can move several times in one step, only their position from
+	// the start of the step and their final position are reported
+	auto recordMove = [&](GraphicalEntityIndex entity, GraphicalEntityIndex from)
+	{
+		if (!entityMoved[entity / componentsPerEntity])
+		{
+			entityMoved[entity / componentsPerEntity] = true;
+			movedEntities.push_back(entity);
+			remaps.push_back({ from, from });
+		}
+	};
+
+	while (reorderProgress < reorderSlots.size() && nrOfSwaps < maxEntitiesToMove)
+	{
+		GraphicalEntityIndex slot = reorderSlots[reorderProgress];
+		GraphicalEntityIndex wanted = reorderOrder[reorderProgress];
+		GraphicalEntityIndex from = entityPositions[wanted / componentsPerEntity];
+
+		if (from != slot)
+		{
+			GraphicalEntityIndex displaced = slotOccupants[slot / componentsPerEntity];
+			recordMove(wanted, from);
+			recordMove(displaced, slot);
+
+			SwapEntities(slot, from);
+			entityPositions[wanted / componentsPerEntity] = slot;
+			entityPositions[displaced / componentsPerEntity] = from;
+			slotOccupants[slot / componentsPerEntity] = wanted;
+			slotOccupants[from / componentsPerEntity] = displaced;
+			++nrOfSwaps;
+		}
+
+		++reorderProgress;
+	}
+
+	for (size_t i = 0; i < remaps.size(); ++i)
+	{
+		remaps[i].newIndex = entityPositions[movedEntities[i] / componentsPerEntity];
+		entityMoved[movedEntities[i] / componentsPerEntity] = false;
+	}
+
+	remaps.erase(std::remove_if(remaps.begin(), remaps.end(),
+		[](const EntityRemap& remap) { return remap.oldIndex == remap.newIndex; }),
+		remaps.end());
+
+	if (reorderProgress == reorderSlots.size())
+		CancelReorder();
+}
+
+template<typename ComponentIndex>
+inline bool GraphicalComponentRegistry<ComponentIndex>::ReorderInProgress() const
+{
+	return reorderProgress < reorderSlots.size();
+}
\ No newline at end of file
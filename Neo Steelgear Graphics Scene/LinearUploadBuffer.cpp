@@ -0,0 +1,73 @@
+#include "LinearUploadBuffer.h"
+
+#include <stdexcept>
+
+void LinearUploadBuffer::Initialize(ID3D12Device* device, size_t bufferSize)
+{
+	size = bufferSize;
+	offset = 0;
+
+	D3D12_HEAP_PROPERTIES heapProperties;
+	ZeroMemory(&heapProperties, sizeof(heapProperties));
+	heapProperties.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+	D3D12_RESOURCE_DESC desc;
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	desc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+	desc.Width = size;
+	desc.Height = 1;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.Format = DXGI_FORMAT_UNKNOWN;
+	desc.SampleDesc.Count = 1;
+	desc.SampleDesc.Quality = 0;
+	desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+	HRESULT hr = device->CreateCommittedResource(&heapProperties,
+		D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+		IID_PPV_ARGS(&buffer));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create linear upload buffer");
+
+	D3D12_RANGE nothingToRead = { 0, 0 };
+	hr = buffer->Map(0, &nothingToRead, reinterpret_cast<void**>(&mappedPtr));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not map linear upload buffer");
+}
+
+size_t LinearUploadBuffer::Allocate(size_t nrOfBytes, size_t alignment)
+{
+	size_t alignedOffset = ((offset + alignment - 1) / alignment) * alignment;
+
+	if (alignedOffset + nrOfBytes > size)
+		return size_t(-1);
+
+	offset = alignedOffset + nrOfBytes;
+	return alignedOffset;
+}
+
+unsigned char* LinearUploadBuffer::GetMappedPtr(size_t allocationOffset)
+{
+	return mappedPtr + allocationOffset;
+}
+
+ID3D12Resource* LinearUploadBuffer::GetResource()
+{
+	return buffer;
+}
+
+void LinearUploadBuffer::Reset()
+{
+	offset = 0;
+}
+
+size_t LinearUploadBuffer::GetSize() const
+{
+	return size;
+}
+
+size_t LinearUploadBuffer::GetUsedBytes() const
+{
+	return offset;
+}
\ No newline at end of file
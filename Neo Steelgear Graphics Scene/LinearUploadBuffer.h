@@ -0,0 +1,32 @@
+#pragma once
+
+#include <d3d12.h>
+
+#include "D3DPtr.h"
+
+class LinearUploadBuffer
+{
+private:
+	D3DPtr<ID3D12Resource> buffer;
+	unsigned char* mappedPtr = nullptr;
+	size_t size = 0;
+	size_t offset = 0;
+
+public:
+	LinearUploadBuffer() = default;
+	~LinearUploadBuffer() = default;
+	LinearUploadBuffer(const LinearUploadBuffer& other) = delete;
+	LinearUploadBuffer& operator=(const LinearUploadBuffer& other) = delete;
+	LinearUploadBuffer(LinearUploadBuffer&& other) = default;
+	LinearUploadBuffer& operator=(LinearUploadBuffer&& other) = default;
+
+	void Initialize(ID3D12Device* device, size_t bufferSize);
+
+	size_t Allocate(size_t nrOfBytes, size_t alignment);
+	unsigned char* GetMappedPtr(size_t allocationOffset);
+	ID3D12Resource* GetResource();
+	void Reset();
+
+	size_t GetSize() const;
+	size_t GetUsedBytes() const;
+};
\ No newline at end of file
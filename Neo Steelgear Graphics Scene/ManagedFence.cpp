@@ -4,7 +4,8 @@
 
 ManagedFence::~ManagedFence()
 {
-	fence->Release();
+	if (fence != nullptr)
+		fence->Release();
 }
 
 void ManagedFence::Initialize(ID3D12Device* device, size_t initialValue)
@@ -26,9 +27,9 @@ void ManagedFence::WaitGPU(ID3D12CommandQueue* queue)
 
 void ManagedFence::WaitCPU()
 {
-	if (fence->GetCompletedValue() < 1)
+	if (fence->GetCompletedValue() < currentValue)
 	{
-		HRESULT hr = fence->SetEventOnCompletion(1, fenceHandle);
+		HRESULT hr = fence->SetEventOnCompletion(currentValue, fenceHandle);
 		if(FAILED(hr))
 			throw std::runtime_error("Could not set wait event for fence");
 		WaitForSingleObject(fenceHandle, INFINITE);
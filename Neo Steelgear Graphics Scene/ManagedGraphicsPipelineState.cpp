@@ -33,14 +33,26 @@ D3D12_ROOT_PARAMETER ManagedGraphicsPipelineState::CreateRootDescriptor(
 	D3D12_ROOT_PARAMETER toReturn;
 	toReturn.ShaderVisibility = binding.shaderAssociation;
 	toReturn.ParameterType = binding.parameterType;
-	toReturn.Descriptor.ShaderRegister = binding.registerNr;
-	toReturn.Descriptor.RegisterSpace = 0;
+
+	if (binding.parameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS)
+	{
+		toReturn.Constants.ShaderRegister = binding.registerNr;
+		toReturn.Constants.RegisterSpace = 0;
+		toReturn.Constants.Num32BitValues = binding.num32BitValues;
+	}
+	else
+	{
+		toReturn.Descriptor.ShaderRegister = binding.registerNr;
+		toReturn.Descriptor.RegisterSpace = 0;
+	}
+
 	return toReturn;
 }
 
 void ManagedGraphicsPipelineState::CreateRootSignature(
 	std::vector<RootBufferBinding> rootBufferBindings,
-	const std::vector<D3D12_STATIC_SAMPLER_DESC>& staticSamplers)
+	const std::vector<D3D12_STATIC_SAMPLER_DESC>& staticSamplers,
+	bool directlyIndexedSamplers)
 {
 	std::vector<D3D12_ROOT_PARAMETER> rootParameters;
 	rootParameters.reserve(rootBufferBindings.size());
@@ -53,6 +65,8 @@ void ManagedGraphicsPipelineState::CreateRootSignature(
 	desc.NumStaticSamplers = static_cast<UINT>(staticSamplers.size());
 	desc.pStaticSamplers = staticSamplers.size() > 0 ? &staticSamplers[0] : nullptr;
 	desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_CBV_SRV_UAV_HEAP_DIRECTLY_INDEXED;
+	if (directlyIndexedSamplers)
+		desc.Flags |= D3D12_ROOT_SIGNATURE_FLAG_SAMPLER_HEAP_DIRECTLY_INDEXED;
 
 	ID3DBlob* serialized;
 	ID3DBlob* error;
@@ -211,7 +225,8 @@ void ManagedGraphicsPipelineState::Initialize(ID3D12Device* deviceToUse,
 {
 	device = deviceToUse;
 	CreateRootSignature(graphicsPipelineData.rootBufferBindings,
-		graphicsPipelineData.staticSamplers);
+		graphicsPipelineData.staticSamplers,
+		graphicsPipelineData.directlyIndexedSamplers);
 	CreatePipelineState(graphicsPipelineData.shaderPaths, 
 		graphicsPipelineData.dsvFormat, graphicsPipelineData.rtvFormats);
 	CreateViewport(graphicsPipelineData.rendertargetWidth,
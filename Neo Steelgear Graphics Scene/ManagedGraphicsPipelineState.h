@@ -20,12 +20,14 @@ struct RootBufferBinding
 	D3D12_SHADER_VISIBILITY shaderAssociation;
 	std::uint8_t registerNr = std::uint8_t(-1);
 	D3D12_ROOT_PARAMETER_TYPE parameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	std::uint8_t num32BitValues = 0;
 };
 
 struct GraphicsPipelineData
 {
 	std::array<std::string, 5> shaderPaths = {"", "", "", "", ""};
 	std::vector<D3D12_STATIC_SAMPLER_DESC> staticSamplers;
+	bool directlyIndexedSamplers = false;
 	unsigned int rendertargetWidth;
 	unsigned int rendertargetHeight;
 	DXGI_FORMAT dsvFormat = DXGI_FORMAT_D32_FLOAT;
@@ -56,7 +58,8 @@ private:
 
 	D3D12_ROOT_PARAMETER CreateRootDescriptor(const RootBufferBinding& binding);
 	void CreateRootSignature(std::vector<RootBufferBinding> rootBufferBindings,
-		const std::vector<D3D12_STATIC_SAMPLER_DESC>& staticSamplers);
+		const std::vector<D3D12_STATIC_SAMPLER_DESC>& staticSamplers,
+		bool directlyIndexedSamplers);
 	void CreatePipelineState(const std::array<std::string, 5>& shaderPaths,
 		DXGI_FORMAT dsvFormat, const std::vector<DXGI_FORMAT>& rtvFormats);
 	void CreateViewport(unsigned int width, unsigned int height);
@@ -1,13 +1,29 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
 #include <optional>
+#include <string>
 
 #include "FrameBased.h"
 #include "FrameBufferComponent.h"
 #include "FrameTexture2DComponent.h"
 #include "DirectAccessComponentBinder.h"
 #include "ComponentDescriptorHeap.h"
+#include "ManagedCommandAllocator.h"
+#include "ManagedFence.h"
+#include "FrameArena.h"
+#include "UploaderChain.h"
+#include "ResourceStateTracker.h"
+#include "LinearUploadBuffer.h"
+#include "ScatterUpdateBatcher.h"
+#include "ScatterUpdatePipeline.h"
+#include "UpdateWorkerPool.h"
 #include "D3DPtr.h"
 
 typedef unsigned int ComponentIndex;
@@ -48,6 +64,75 @@ namespace std {
 
 }
 
+struct ComponentManifestEntry
+{
+	ComponentType type = ComponentType::BUFFER;
+	bool dynamic = true;
+	UpdateType updateType = UpdateType::NONE;
+	unsigned int maxResources = 0;
+
+	size_t elementSize = 0;
+	size_t elementAlignment = 0;
+	size_t maxElements = 0;
+
+	size_t totalBytes = 0;
+	std::uint8_t texelSize = 0;
+	DXGI_FORMAT texelFormat = DXGI_FORMAT_UNKNOWN;
+
+	bool cbv = false;
+	bool srv = false;
+	bool uav = false;
+	bool rtv = false;
+	bool dsv = false;
+};
+
+struct ComponentMemoryInfo
+{
+	size_t cpuBytes = 0;
+	size_t gpuBytes = 0;
+};
+
+template<typename Element>
+inline ComponentManifestEntry CreateBufferManifestEntry(bool dynamic,
+	unsigned int maxElements, unsigned int maxBuffers,
+	UpdateType componentUpdateType, bool cbv, bool srv, bool uav)
+{
+	ComponentManifestEntry toReturn;
+	toReturn.type = ComponentType::BUFFER;
+	toReturn.dynamic = dynamic;
+	toReturn.updateType = componentUpdateType;
+	toReturn.maxResources = maxBuffers;
+	toReturn.elementSize = sizeof(Element);
+	toReturn.elementAlignment = alignof(Element);
+	toReturn.maxElements = maxElements;
+	toReturn.cbv = cbv;
+	toReturn.srv = srv;
+	toReturn.uav = uav;
+
+	return toReturn;
+}
+
+inline ComponentManifestEntry CreateTexture2DManifestEntry(bool dynamic,
+	size_t totalBytes, unsigned int maxNrOfTextures, std::uint8_t texelSize,
+	DXGI_FORMAT texelFormat, UpdateType componentUpdateType,
+	bool srv, bool uav = false, bool rtv = false, bool dsv = false)
+{
+	ComponentManifestEntry toReturn;
+	toReturn.type = ComponentType::TEXTURE2D;
+	toReturn.dynamic = dynamic;
+	toReturn.updateType = componentUpdateType;
+	toReturn.maxResources = maxNrOfTextures;
+	toReturn.totalBytes = totalBytes;
+	toReturn.texelSize = texelSize;
+	toReturn.texelFormat = texelFormat;
+	toReturn.srv = srv;
+	toReturn.uav = uav;
+	toReturn.rtv = rtv;
+	toReturn.dsv = dsv;
+
+	return toReturn;
+}
+
 template<FrameType Frames>
 class ManagedResourceComponents : FrameBased<Frames>
 {
@@ -55,6 +140,7 @@ private:
 	unsigned int rtvSize = 0;
 	unsigned int dsvSize = 0;
 	unsigned int shaderViewSize = 0;
+	unsigned int staticDescriptors = 0;
 	unsigned int descriptorsPerFrame = 0;
 
 	ID3D12Device* device = nullptr;
@@ -65,8 +151,112 @@ private:
 	std::vector<FrameTexture2DComponent<1>> staticTexture2DComponents;
 
 	ComponentDescriptorHeap<Frames, ComponentIdentifier> componentDescriptorHeap;
+	std::array<std::vector<size_t>, 8> descriptorSlots;
+	std::array<std::vector<std::uint64_t>, 8> componentGenerations;
+	std::array<std::vector<FrameType>, 8> updateFramesLeft;
+	std::vector<ComponentIdentifier> componentsToUpdate;
+	std::vector<D3D12_RESOURCE_BARRIER> updateBarriers;
+
+	struct ComponentUploadInfo
+	{
+		size_t elementSize = 0;
+		size_t alignment = 0;
+		size_t capacity = 0;
+		size_t pendingBytes = 0;
+		size_t pendingResources = 0;
+		std::uint8_t priority = 0;
+		std::optional<D3D12_RESOURCE_STATES> usageState;
+		std::vector<ResourceIndex> updatedResources;
+		std::vector<ResourceIndex> liveResources;
+		UpdateType updateType = UpdateType::NONE;
+		std::vector<std::pair<ResourceIndex, size_t>> initialisedResources;
+		size_t lastUploadFrame = 0;
+		bool awaitingCompletion = false;
+	};
+
+	std::array<std::vector<ComponentUploadInfo>, 8> uploadInfos;
+	std::vector<ComponentIdentifier> deferredComponents;
+	size_t uploadBudget = 0;
+	size_t uploadedBytesThisFrame = 0;
+	size_t deferredUpdatesThisFrame = 0;
+	ResourceStateTracker stateTracker;
+
+	size_t frameCounter = 0;
+	std::array<size_t, Frames> copyFrameEpochs = {};
+	std::vector<ComponentIdentifier> uploadsAwaitingCompletion;
+	std::function<void(const ComponentIdentifier&)> uploadCompletedCallback;
+
+	struct DirectBufferWrite
+	{
+		ComponentIdentifier identifier;
+		ID3D12Resource* resource = nullptr;
+		size_t destinationOffset = 0;
+		size_t sourceOffset = 0;
+		size_t nrOfBytes = 0;
+	};
+
+	LinearUploadBuffer directWriteBuffers[Frames];
+	std::vector<DirectBufferWrite> directBufferWrites;
+
+	// Upload heap buffers are mapped on their first direct write and stay
+	// mapped, the reference keeps the address from being reused while cached
+	struct MappedWriteResource
+	{
+		D3DPtr<ID3D12Resource> resource;
+		unsigned char* mappedPtr = nullptr;
+	};
+
+	std::vector<MappedWriteResource> mappedWriteResources;
+
+	struct ScatterBufferUpdate
+	{
+		ComponentIdentifier identifier;
+		ID3D12Resource* resource = nullptr;
+		D3D12_GPU_VIRTUAL_ADDRESS target = 0;
+		size_t sourceOffset = 0;
+		UINT nrOfUpdates = 0;
+		UINT elementStride = 0;
+	};
+
+	ScatterUpdatePipeline scatterPipeline;
+	LinearUploadBuffer scatterUploadBuffers[Frames];
+	std::vector<ScatterBufferUpdate> scatterBufferUpdates;
+	std::vector<ID3D12Resource*> scatteredResources;
+	size_t copyCommandsSavedThisFrame = 0;
+
+	enum class ManifestHeapCategory
+	{
+		BUFFER = 0,
+		UPLOAD_BUFFER = 1,
+		TEXTURE = 2,
+		TARGET_TEXTURE = 3,
+		NONE = 4
+	};
 
-	ResourceUploader uploaders[Frames];
+	std::vector<D3DPtr<ID3D12Heap>> componentHeaps;
+
+	UploaderChain uploaders[Frames];
+	FrameArena<Frames> frameArena;
+
+	size_t nrOfUpdateWorkers = 0;
+	std::vector<std::unique_ptr<ManagedCommandAllocator>> workerAllocators;
+	std::vector<ResourceUploader> workerUploaders;
+	std::vector<std::vector<D3D12_RESOURCE_BARRIER>> workerBarriers;
+	std::unique_ptr<UpdateWorkerPool> workerPool;
+	size_t nrOfParallelUpdates = 0;
+	bool workerListsRecorded = false;
+
+	bool copyQueueUploads = false;
+	std::unique_ptr<ManagedCommandAllocator[]> copyAllocators;
+	std::unique_ptr<ManagedFence[]> copyFences;
+	ManagedFence directQueueFence;
+	std::unique_ptr<ResourceUploader[]> copyUploaders;
+	std::vector<ComponentIdentifier> copyComponentsToUpdate;
+	std::array<std::vector<size_t>, 8> copyUploadEpochs;
+	size_t nrOfPreparedCopyUpdates = 0;
+	size_t currentCopyEpoch = 0;
+	size_t waitedCopyEpoch = 0;
+	FrameType lastCopyFrame = 0;
 
 	template<typename ViewDescType>
 	DescriptorAllocationInfo<ViewDescType> CreateCustomDAI(ViewType viewType,
@@ -87,15 +277,59 @@ private:
 		bool cbv, bool srv, bool uav, bool rtv, bool dsv, size_t maxNrOfDescriptors);
 
 	void InitialiseResourceUploaders(size_t minSizePerUploader,
-		AllocationStrategy allocationStrategy);
+		AllocationStrategy allocationStrategy, size_t idleFramesBeforeShrink);
+	void RecordWorkerUpdates(size_t workerIndex, size_t start, size_t end);
+	static void RecordWorkerUpdatesJob(void* context, size_t workerIndex);
+
+	ResourceComponent& GetComponent(const ComponentIdentifier& identifier);
+	size_t GetSlotTableIndex(const ComponentIdentifier& identifier) const;
+	std::vector<size_t>& GetDescriptorSlots(const ComponentIdentifier& identifier);
+	FrameType& GetUpdateFramesLeft(const ComponentIdentifier& identifier);
+	ComponentUploadInfo& GetUploadInfo(const ComponentIdentifier& identifier);
+	void AddPendingUploadBytes(const ComponentIdentifier& identifier,
+		size_t nrOfBytes);
+	void RecordInitialisedBytes(const ComponentIdentifier& identifier,
+		ResourceIndex resourceIndex, size_t nrOfBytes);
+	size_t GetUploadEstimate(const ComponentIdentifier& identifier);
+	size_t ScheduleUpdates(std::vector<ComponentIdentifier>& worklist);
+	void FinishScheduledUpdates(std::vector<ComponentIdentifier>& worklist,
+		size_t nrOfScheduled);
+	bool IsCopyEpochComplete(size_t epoch);
+	void ProcessCompletedUploads();
+	void ChangeComponentState(const ComponentIdentifier& identifier,
+		ResourceIndex resourceIndex, D3D12_RESOURCE_STATES newState);
+	void ChangeComponentState(const ComponentIdentifier& identifier,
+		ResourceIndex resourceIndex, D3D12_RESOURCE_STATES newState,
+		std::vector<D3D12_RESOURCE_BARRIER>& barriers);
+	void ChangeUpdatedResourcesState(const ComponentIdentifier& identifier,
+		D3D12_RESOURCE_STATES newState);
+	void ChangeUpdatedResourcesState(const ComponentIdentifier& identifier,
+		D3D12_RESOURCE_STATES newState,
+		std::vector<D3D12_RESOURCE_BARRIER>& barriers);
+
+	ManifestHeapCategory GetManifestHeapCategory(
+		const ComponentManifestEntry& entry) const;
+	size_t GetManifestHeapSize(const ComponentManifestEntry& entry) const;
+	ID3D12Heap* CreateComponentHeap(ManifestHeapCategory category,
+		size_t heapSize);
+	void InitializeManifestComponent(const ComponentManifestEntry& entry,
+		const ComponentIdentifier& identifier, const ResourceHeapInfo& heapInfo);
+	template<typename Function>
+	void VisitComponent(const ComponentIdentifier& identifier, Function function);
+	void RegisterComponent(const ComponentIdentifier& identifier,
+		const ResourceComponent& component, unsigned int maxResources);
 
 public:
 	ManagedResourceComponents() = default;
 	~ManagedResourceComponents() = default;
 
 	void Initialize(ID3D12Device* deviceToUse, size_t minSizePerUploader,
-		AllocationStrategy allocationStrategy);
-	void FinalizeComponents();
+		AllocationStrategy allocationStrategy, size_t idleFramesBeforeShrink = 60);
+	void FinalizeComponents(size_t transientDescriptors = 0);
+
+	std::vector<ComponentIdentifier> CreateComponents(
+		const std::vector<ComponentManifestEntry>& manifest,
+		size_t nrOfThreads = 1);
 
 	template<typename Element>
 	ComponentIdentifier CreateBufferComponent(bool dynamic,
@@ -119,6 +353,8 @@ public:
 		std::optional<Texture2DViewDesc> srv, std::optional<Texture2DViewDesc> uav,
 		std::optional<Texture2DViewDesc> rtv, std::optional<Texture2DViewDesc> dsv);
 
+	// Mutable access can change descriptors or update data without going
+	// through the wrappers below, so it marks both as changed
 	FrameBufferComponent<Frames>& GetDynamicBufferComponent(
 		const ComponentIdentifier& componentIdentifier);
 	FrameBufferComponent<1>& GetStaticBufferComponent(
@@ -128,10 +364,99 @@ public:
 	FrameTexture2DComponent<1>& GetStaticTexture2DComponent(
 		const ComponentIdentifier& componentIdentifier);
 
+	ResourceIndex CreateBuffer(const ComponentIdentifier& componentIdentifier,
+		size_t nrOfElements,
+		const BufferReplacementViews& replacementViews = BufferReplacementViews());
+	ResourceIndex CreateTexture(const ComponentIdentifier& componentIdentifier,
+		const TextureAllocationInfo& allocationInfo,
+		const Texture2DComponentTemplate::TextureReplacementViews&
+		replacementViews = {});
+	void RemoveResource(const ComponentIdentifier& componentIdentifier,
+		ResourceIndex indexToRemove);
+	void MarkComponentDescriptorsChanged(
+		const ComponentIdentifier& componentIdentifier);
+	std::uint64_t GetComponentGeneration(
+		const ComponentIdentifier& componentIdentifier) const;
+
+	void SetBufferUpdateData(const ComponentIdentifier& componentIdentifier,
+		ResourceIndex resourceIndex, void* dataAdress);
+	void SetTextureUpdateData(const ComponentIdentifier& componentIdentifier,
+		ResourceIndex resourceIndex, void* dataAdress, std::uint8_t subresource = 0);
+	void MarkComponentDataChanged(const ComponentIdentifier& componentIdentifier);
+
+	void SetUploadBudget(size_t bytesPerFrame);
+	void SetComponentUploadPriority(const ComponentIdentifier& componentIdentifier,
+		std::uint8_t priority);
+	size_t GetUploadedBytesThisFrame() const;
+	size_t GetNrOfDeferredUpdatesThisFrame() const;
+	size_t GetUploadMemoryCapacity() const;
+	size_t GetPeakUploadMemoryUsage() const;
+
+	void SetComponentUsageState(const ComponentIdentifier& componentIdentifier,
+		D3D12_RESOURCE_STATES usageState);
+	void TransitionComponent(const ComponentIdentifier& componentIdentifier,
+		D3D12_RESOURCE_STATES newState, ResourceIndex resourceIndex = 0);
+	// The update functions leave split barriers open on their command list, they
+	// must be ended with this on the same list before the frame is swapped
+	void FlushResourceBarriers(ID3D12GraphicsCommandList* commandList);
+	size_t GetNrOfSavedBarriers() const;
+
+	void InitializeDirectWrites(size_t bytesPerFrame);
+	// Only dynamic map updated and static copy updated buffers can be written
+	// directly. The writes bypass the CPU copy Core keeps, so a later update of
+	// the same component through the update data functions overwrites them
+	void* BeginBufferWrite(const ComponentIdentifier& componentIdentifier,
+		ResourceIndex resourceIndex);
+	void RecordBufferWrites(ID3D12GraphicsCommandList* commandList);
+
+	void InitializeScatterUpdates(const std::string& shaderPath,
+		size_t bytesPerFrame);
+	// Scatter updates write static buffers on the GPU only, a later update of the
+	// same component through the update data functions overwrites them
+	bool ScatterBufferUpdates(const ComponentIdentifier& componentIdentifier,
+		ResourceIndex resourceIndex, const ScatterUpdateBatcher& batcher);
+	void RecordScatterUpdates(ID3D12GraphicsCommandList* commandList);
+	size_t GetCopyCommandsSavedThisFrame() const;
+
+	// Core keeps the CPU copy of uploaded data until the resource is removed,
+	// the memory report counts it for as long as it is held
+	void SetUploadCompletedCallback(
+		const std::function<void(const ComponentIdentifier&)>& callback);
+	bool IsComponentUploadComplete(const ComponentIdentifier& componentIdentifier);
+	ComponentMemoryInfo GetComponentMemoryInfo(
+		const ComponentIdentifier& componentIdentifier);
+	std::vector<std::pair<ComponentIdentifier, ComponentMemoryInfo>>
+		GetComponentMemoryReport();
+
 	void UpdateComponents(ID3D12GraphicsCommandList* commandList);
-	void BindComponents(ID3D12GraphicsCommandList* commandList);
+	void InitializeUpdateWorkers(size_t nrOfWorkers, size_t minSizePerUploader,
+		AllocationStrategy allocationStrategy);
+	void UpdateComponentsParallel();
+	void ExecuteUpdateLists(ID3D12CommandQueue* queue);
+
+	template<typename T>
+	ArenaAllocator<T> GetFrameAllocator(size_t threadIndex = 0);
+
+	void InitializeCopyQueueUploads(size_t minSizePerUploader,
+		AllocationStrategy allocationStrategy);
+	// Static components are moved to the common state on the direct queue, the
+	// prepared list must be executed before the copy queue update is submitted
+	void PrepareCopyQueueUploads(ID3D12GraphicsCommandList* commandList);
+	void UpdateComponentsCopyQueue(ID3D12CommandQueue* copyQueue,
+		ID3D12CommandQueue* directQueue);
+	void RequireComponentData(const ComponentIdentifier& componentIdentifier,
+		ID3D12CommandQueue* consumerQueue);
+	void WaitForCopyQueueUploads(ID3D12CommandQueue* consumerQueue);
+	void BindComponents(ID3D12GraphicsCommandList* commandList,
+		ID3D12DescriptorHeap* samplerHeap = nullptr);
 	size_t GetComponentDescriptorStart(const ComponentIdentifier& identifier,
 		ViewType viewType);
+	size_t GetDescriptorsCopiedLastFrame() const;
+
+	size_t AllocateTransientDescriptors(size_t nrOfDescriptors);
+	void CopyToTransientDescriptors(size_t heapOffset,
+		D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle, UINT nrOfDescriptors);
+	std::uint64_t GetTransientWrapCount() const;
 
 	void SwapFrame() override;
 };
@@ -262,6 +587,7 @@ ManagedResourceComponents<Frames>::CreateBufferComponent(bool dynamic,
 			componentInfo, descriptorInfo);
 		toReturn = { ComponentType::BUFFER,
 			dynamicBufferComponents.size() - 1, true };
+		RegisterComponent(toReturn, dynamicBufferComponents.back(), maxBuffers);
 	}
 	else
 	{
@@ -270,9 +596,18 @@ ManagedResourceComponents<Frames>::CreateBufferComponent(bool dynamic,
 			componentInfo, descriptorInfo);
 		toReturn = { ComponentType::BUFFER,
 			staticBufferComponents.size() - 1, false };
+		RegisterComponent(toReturn, staticBufferComponents.back(), maxBuffers);
 	}
 
-	descriptorsPerFrame += maxBuffers *
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(toReturn);
+	uploadInfo.elementSize = sizeof(Element);
+	uploadInfo.alignment = alignof(Element);
+	uploadInfo.capacity = maxElements * sizeof(Element);
+	uploadInfo.updateType = componentUpdateType;
+
+	unsigned int& descriptorCount =
+		dynamic ? descriptorsPerFrame : staticDescriptors;
+	descriptorCount += maxBuffers *
 		static_cast<unsigned int>(descriptorInfo.size());
 
 	return toReturn;
@@ -305,6 +640,7 @@ ManagedResourceComponents<Frames>::CreateBufferComponent(bool dynamic,
 			componentInfo, descriptorInfo);
 		toReturn = { ComponentType::BUFFER,
 			dynamicBufferComponents.size() - 1, true };
+		RegisterComponent(toReturn, dynamicBufferComponents.back(), maxBuffers);
 	}
 	else
 	{
@@ -313,9 +649,18 @@ ManagedResourceComponents<Frames>::CreateBufferComponent(bool dynamic,
 			componentInfo, descriptorInfo);
 		toReturn = { ComponentType::BUFFER,
 			staticBufferComponents.size() - 1, false };
+		RegisterComponent(toReturn, staticBufferComponents.back(), maxBuffers);
 	}
 
-	descriptorsPerFrame +=
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(toReturn);
+	uploadInfo.elementSize = sizeof(Element);
+	uploadInfo.alignment = alignof(Element);
+	uploadInfo.capacity = maxElements * sizeof(Element);
+	uploadInfo.updateType = componentUpdateType;
+
+	unsigned int& descriptorCount =
+		dynamic ? descriptorsPerFrame : staticDescriptors;
+	descriptorCount +=
 		static_cast<unsigned int>(maxBuffers * descriptorInfo.size());
 
 	return toReturn;
@@ -323,247 +668,1703 @@ ManagedResourceComponents<Frames>::CreateBufferComponent(bool dynamic,
 
 template<FrameType Frames>
 inline void ManagedResourceComponents<Frames>::InitialiseResourceUploaders(
-	size_t minSizePerUploader, AllocationStrategy allocationStrategy)
+	size_t minSizePerUploader, AllocationStrategy allocationStrategy,
+	size_t idleFramesBeforeShrink)
 {
-	size_t sizePerUploader = 65536 *
-		static_cast<size_t>(std::ceil((1.0 * minSizePerUploader) / 65536));
-
 	for (FrameType i = 0; i < Frames; ++i)
-		uploaders[i].Initialize(device, sizePerUploader, allocationStrategy);
+	{
+		uploaders[i].Initialize(device, minSizePerUploader, allocationStrategy,
+			idleFramesBeforeShrink);
+	}
 }
 
 template<FrameType Frames>
-inline void
-ManagedResourceComponents<Frames>::Initialize(ID3D12Device* deviceToUse,
-	size_t minSizePerUploader, AllocationStrategy allocationStrategy)
+inline ResourceComponent& ManagedResourceComponents<Frames>::GetComponent(
+	const ComponentIdentifier& identifier)
 {
-	device = deviceToUse;
-	rtvSize = device->GetDescriptorHandleIncrementSize(
-		D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
-	dsvSize = device->GetDescriptorHandleIncrementSize(
-		D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
-	shaderViewSize = device->GetDescriptorHandleIncrementSize(
-		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-	InitialiseResourceUploaders(minSizePerUploader, allocationStrategy);
+	switch (identifier.type)
+	{
+	case ComponentType::BUFFER:
+		if (identifier.dynamicComponent)
+			return dynamicBufferComponents[identifier.localIndex];
+		else
+			return staticBufferComponents[identifier.localIndex];
+	case ComponentType::TEXTURE2D:
+		if (identifier.dynamicComponent)
+			return dynamicTexture2DComponents[identifier.localIndex];
+		else
+			return staticTexture2DComponents[identifier.localIndex];
+	default:
+		throw std::runtime_error("Attempting to get component of unsupported type");
+	}
 }
 
 template<FrameType Frames>
-inline void ManagedResourceComponents<Frames>::FinalizeComponents()
+inline size_t ManagedResourceComponents<Frames>::GetSlotTableIndex(
+	const ComponentIdentifier& identifier) const
 {
-	componentDescriptorHeap.Initialize(device, descriptorsPerFrame);
+	return static_cast<size_t>(identifier.type) * 2 +
+		static_cast<size_t>(identifier.dynamicComponent);
 }
 
 template<FrameType Frames>
-inline ComponentIdentifier
-ManagedResourceComponents<Frames>::CreateTexture2DComponent(bool dynamic,
-	size_t totalBytes, unsigned int maxNrOfTextures, std::uint8_t texelSize,
-	DXGI_FORMAT texelFormat, UpdateType componentUpdateType,
-	bool srv, bool uav, bool rtv, bool dsv)
+inline std::vector<size_t>& ManagedResourceComponents<Frames>::GetDescriptorSlots(
+	const ComponentIdentifier& identifier)
 {
-	TextureInfo textureInfo;
-	textureInfo.format = texelFormat;
-	textureInfo.texelSize = texelSize;
-	ResourceHeapInfo heapInfo(totalBytes);
-	TextureComponentInfo componentInfo(texelFormat, texelSize, heapInfo);
+	return descriptorSlots[GetSlotTableIndex(identifier)];
+}
 
-	std::vector<DescriptorAllocationInfo<Texture2DViewDesc>> descriptorInfo =
-		CreateDefaultDAIVector<Texture2DViewDesc>(false, srv, uav, rtv, dsv,
-			maxNrOfTextures);
+template<FrameType Frames>
+inline FrameType& ManagedResourceComponents<Frames>::GetUpdateFramesLeft(
+	const ComponentIdentifier& identifier)
+{
+	return updateFramesLeft[GetSlotTableIndex(identifier)][identifier.localIndex];
+}
 
-	ComponentIdentifier toReturn;
-	if (dynamic)
-	{
-		dynamicTexture2DComponents.push_back(FrameTexture2DComponent<Frames>());
-		dynamicTexture2DComponents.back().Initialize(device, componentUpdateType,
-			componentInfo, descriptorInfo);
-		toReturn = { ComponentType::TEXTURE2D,
-			dynamicTexture2DComponents.size() - 1, true };
-	}
-	else
+template<FrameType Frames>
+inline typename ManagedResourceComponents<Frames>::ComponentUploadInfo&
+ManagedResourceComponents<Frames>::GetUploadInfo(
+	const ComponentIdentifier& identifier)
+{
+	return uploadInfos[GetSlotTableIndex(identifier)][identifier.localIndex];
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::AddPendingUploadBytes(
+	const ComponentIdentifier& identifier, size_t nrOfBytes)
+{
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(identifier);
+	uploadInfo.pendingBytes = std::min(uploadInfo.pendingBytes + nrOfBytes,
+		uploadInfo.capacity);
+	++uploadInfo.pendingResources;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RecordInitialisedBytes(
+	const ComponentIdentifier& identifier, ResourceIndex resourceIndex,
+	size_t nrOfBytes)
+{
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(identifier);
+	if (uploadInfo.updateType != UpdateType::INITIALISE_ONLY)
+		return;
+
+	for (auto& initialised : uploadInfo.initialisedResources)
 	{
-		staticTexture2DComponents.push_back(FrameTexture2DComponent<1>());
-		staticTexture2DComponents.back().Initialize(device, componentUpdateType,
-			componentInfo, descriptorInfo);
-		toReturn = { ComponentType::TEXTURE2D,
-			staticTexture2DComponents.size() - 1, false };
+		if (initialised.first == resourceIndex)
+		{
+			initialised.second += nrOfBytes;
+			return;
+		}
 	}
 
-	descriptorsPerFrame += maxNrOfTextures *
-		static_cast<unsigned int>(descriptorInfo.size());
-
-	return toReturn;
+	uploadInfo.initialisedResources.push_back({ resourceIndex, nrOfBytes });
 }
 
 template<FrameType Frames>
-inline ComponentIdentifier
-ManagedResourceComponents<Frames>::CreateTexture2DComponent(bool dynamic,
-	size_t totalBytes, unsigned int maxNrOfTextures, std::uint8_t texelSize,
-	DXGI_FORMAT texelFormat, UpdateType componentUpdateType,
-	std::optional<Texture2DViewDesc> srv, std::optional<Texture2DViewDesc> uav,
-	std::optional<Texture2DViewDesc> rtv, std::optional<Texture2DViewDesc> dsv)
+inline size_t ManagedResourceComponents<Frames>::GetUploadEstimate(
+	const ComponentIdentifier& identifier)
 {
-	TextureInfo textureInfo;
-	textureInfo.format = texelFormat;
-	textureInfo.texelSize = texelSize;
-	ResourceHeapInfo heapInfo(totalBytes);
-	TextureComponentInfo componentInfo(texelFormat, texelSize, heapInfo);
-
-	std::vector<DescriptorAllocationInfo<Texture2DViewDesc>> descriptorInfo =
-		CreateCustomDAIVector<Texture2DViewDesc>(std::nullopt, srv, uav, rtv,
-			dsv, maxNrOfTextures);
+	// Every resource is placed separately in the upload buffer and may need
+	// up to a full alignment of padding
+	const ComponentUploadInfo& uploadInfo = GetUploadInfo(identifier);
+	return uploadInfo.pendingBytes +
+		uploadInfo.pendingResources * uploadInfo.alignment;
+}
 
-	ComponentIdentifier toReturn;
-	if (dynamic)
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::ScheduleUpdates(
+	std::vector<ComponentIdentifier>& worklist)
+{
+	if (uploadBudget == 0)
 	{
-		dynamicTexture2DComponents.push_back(FrameTexture2DComponent<Frames>());
-		dynamicTexture2DComponents.back().Initialize(device, componentUpdateType,
-			componentInfo, descriptorInfo);
-		toReturn = { ComponentType::TEXTURE2D,
-			dynamicTexture2DComponents.size() - 1, true };
+		for (auto& identifier : worklist)
+			uploadedBytesThisFrame += GetUploadEstimate(identifier);
+
+		return worklist.size();
 	}
-	else
+
+	std::stable_sort(worklist.begin(), worklist.end(),
+		[this](const ComponentIdentifier& a, const ComponentIdentifier& b)
+		{
+			return GetUploadInfo(a).priority > GetUploadInfo(b).priority;
+		});
+
+	size_t nrOfScheduled = 0;
+	deferredComponents.clear();
+	for (size_t i = 0; i < worklist.size(); ++i)
 	{
-		staticTexture2DComponents.push_back(FrameTexture2DComponent<1>());
-		staticTexture2DComponents.back().Initialize(device, componentUpdateType,
-			componentInfo, descriptorInfo);
-		toReturn = { ComponentType::TEXTURE2D,
-			staticTexture2DComponents.size() - 1, false };
+		size_t nrOfBytes = GetUploadEstimate(worklist[i]);
+
+		if (uploadedBytesThisFrame == 0 ||
+			uploadedBytesThisFrame + nrOfBytes <= uploadBudget)
+		{
+			worklist[nrOfScheduled++] = worklist[i];
+			uploadedBytesThisFrame += nrOfBytes;
+		}
+		else
+		{
+			deferredComponents.push_back(worklist[i]);
+		}
 	}
 
-	descriptorsPerFrame += maxNrOfTextures *
-		static_cast<unsigned int>(descriptorInfo.size());
+	std::copy(deferredComponents.begin(), deferredComponents.end(),
+		worklist.begin() + nrOfScheduled);
+	deferredUpdatesThisFrame += deferredComponents.size();
 
-	return toReturn;
+	return nrOfScheduled;
 }
 
 template<FrameType Frames>
-inline FrameBufferComponent<Frames>&
-ManagedResourceComponents<Frames>::GetDynamicBufferComponent(
-	const ComponentIdentifier& componentIdentifier)
+inline void ManagedResourceComponents<Frames>::FinishScheduledUpdates(
+	std::vector<ComponentIdentifier>& worklist, size_t nrOfScheduled)
 {
-	return dynamicBufferComponents[componentIdentifier.localIndex];
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		if (--GetUpdateFramesLeft(worklist[i]) == 0)
+		{
+			ComponentUploadInfo& uploadInfo = GetUploadInfo(worklist[i]);
+			uploadInfo.pendingBytes = 0;
+			uploadInfo.pendingResources = 0;
+			uploadInfo.updatedResources.clear();
+			uploadInfo.lastUploadFrame = frameCounter;
+
+			if (!uploadInfo.awaitingCompletion)
+			{
+				uploadInfo.awaitingCompletion = true;
+				uploadsAwaitingCompletion.push_back(worklist[i]);
+			}
+		}
+	}
+
+	worklist.erase(std::remove_if(worklist.begin(), worklist.end(),
+		[this](const ComponentIdentifier& identifier)
+		{
+			return GetUpdateFramesLeft(identifier) == 0;
+		}), worklist.end());
 }
 
 template<FrameType Frames>
-inline FrameBufferComponent<1>&
-ManagedResourceComponents<Frames>::GetStaticBufferComponent(
-	const ComponentIdentifier& componentIdentifier)
+inline bool ManagedResourceComponents<Frames>::IsCopyEpochComplete(size_t epoch)
 {
-	return staticBufferComponents[componentIdentifier.localIndex];
+	if (epoch == 0)
+		return true;
 
+	for (FrameType i = 0; i < Frames; ++i)
+	{
+		if (copyFrameEpochs[i] >= epoch && copyFences[i].Completed())
+			return true;
+	}
+
+	return false;
 }
 
 template<FrameType Frames>
-inline FrameTexture2DComponent<Frames>&
-ManagedResourceComponents<Frames>::GetDynamicTexture2DComponent(
-	const ComponentIdentifier& componentIdentifier)
+inline void ManagedResourceComponents<Frames>::ProcessCompletedUploads()
 {
-	return dynamicTexture2DComponents[componentIdentifier.localIndex];
+	for (size_t i = 0; i < uploadsAwaitingCompletion.size();)
+	{
+		const ComponentIdentifier identifier = uploadsAwaitingCompletion[i];
+		ComponentUploadInfo& uploadInfo = GetUploadInfo(identifier);
+		size_t copyEpoch =
+			copyUploadEpochs[GetSlotTableIndex(identifier)][identifier.localIndex];
+
+		if (GetUpdateFramesLeft(identifier) != 0 ||
+			frameCounter < uploadInfo.lastUploadFrame + Frames ||
+			!IsCopyEpochComplete(copyEpoch))
+		{
+			++i;
+			continue;
+		}
+
+		uploadInfo.awaitingCompletion = false;
+		uploadsAwaitingCompletion.erase(uploadsAwaitingCompletion.begin() + i);
+
+		if (uploadCompletedCallback)
+			uploadCompletedCallback(identifier);
+	}
 }
 
 template<FrameType Frames>
-inline FrameTexture2DComponent<1>&
-ManagedResourceComponents<Frames>::GetStaticTexture2DComponent(
-	const ComponentIdentifier& componentIdentifier)
+inline void ManagedResourceComponents<Frames>::ChangeComponentState(
+	const ComponentIdentifier& identifier, ResourceIndex resourceIndex,
+	D3D12_RESOURCE_STATES newState)
 {
-	return staticTexture2DComponents[componentIdentifier.localIndex];
+	ChangeComponentState(identifier, resourceIndex, newState, updateBarriers);
 }
 
 template<FrameType Frames>
-inline void ManagedResourceComponents<Frames>::UpdateComponents(
-	ID3D12GraphicsCommandList* commandList)
+inline void ManagedResourceComponents<Frames>::ChangeComponentState(
+	const ComponentIdentifier& identifier, ResourceIndex resourceIndex,
+	D3D12_RESOURCE_STATES newState, std::vector<D3D12_RESOURCE_BARRIER>& barriers)
 {
-	static std::vector<D3D12_RESOURCE_BARRIER> barriers;
-
-	for (auto& bufferComponent : dynamicBufferComponents)
-		bufferComponent.PrepareResourcesForUpdates(barriers);
-
-	for (auto& bufferComponent : staticBufferComponents)
-		bufferComponent.PrepareResourcesForUpdates(barriers);
-
-	for (auto& texture2DComponent : dynamicTexture2DComponents)
-		texture2DComponent.PrepareResourcesForUpdates(barriers);
-
-	for (auto& texture2DComponent : staticTexture2DComponents)
-		texture2DComponent.PrepareResourcesForUpdates(barriers);
-
-	if (barriers.size() != 0)
+	switch (identifier.type)
 	{
-		commandList->ResourceBarrier(static_cast<UINT>(barriers.size()),
-			barriers.data());
-		barriers.clear();
+	case ComponentType::BUFFER:
+		if (identifier.dynamicComponent)
+		{
+			dynamicBufferComponents[identifier.localIndex].ChangeToState(
+				barriers, newState);
+		}
+		else
+		{
+			staticBufferComponents[identifier.localIndex].ChangeToState(
+				barriers, newState);
+		}
+		break;
+	case ComponentType::TEXTURE2D:
+		if (identifier.dynamicComponent)
+		{
+			dynamicTexture2DComponents[identifier.localIndex].ChangeToState(
+				resourceIndex, barriers, newState);
+		}
+		else
+		{
+			staticTexture2DComponents[identifier.localIndex].ChangeToState(
+				resourceIndex, barriers, newState);
+		}
+		break;
+	default:
+		throw std::runtime_error("Attempting to transition component of unsupported type");
 	}
+}
 
-	for (auto& bufferComponent : dynamicBufferComponents)
-		bufferComponent.PerformUpdates(commandList, uploaders[this->activeFrame]);
-
-	for (auto& bufferComponent : staticBufferComponents)
-		bufferComponent.PerformUpdates(commandList, uploaders[this->activeFrame]);
-
-	for (auto& texture2DComponent : dynamicTexture2DComponents)
-		texture2DComponent.PerformUpdates(commandList, uploaders[this->activeFrame]);
-
-	for (auto& texture2DComponent : staticTexture2DComponents)
-		texture2DComponent.PerformUpdates(commandList, uploaders[this->activeFrame]);
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::ChangeUpdatedResourcesState(
+	const ComponentIdentifier& identifier, D3D12_RESOURCE_STATES newState)
+{
+	ChangeUpdatedResourcesState(identifier, newState, updateBarriers);
 }
 
 template<FrameType Frames>
-inline void ManagedResourceComponents<Frames>::BindComponents(
-	ID3D12GraphicsCommandList* commandList)
+inline void ManagedResourceComponents<Frames>::ChangeUpdatedResourcesState(
+	const ComponentIdentifier& identifier, D3D12_RESOURCE_STATES newState,
+	std::vector<D3D12_RESOURCE_BARRIER>& barriers)
 {
-	ComponentIdentifier identifier;
-	identifier.type = ComponentType::BUFFER;
-	identifier.dynamicComponent = true;
-	for (size_t i = 0; i < dynamicBufferComponents.size(); ++i)
+	if (identifier.type == ComponentType::BUFFER)
 	{
-		identifier.localIndex = i;
-		componentDescriptorHeap.AddComponentDescriptors(identifier,
-			dynamicBufferComponents[i]);
+		ChangeComponentState(identifier, 0, newState, barriers);
+		return;
 	}
 
-	identifier.dynamicComponent = false;
-	for (size_t i = 0; i < staticBufferComponents.size(); ++i)
-	{
-		identifier.localIndex = i;
-		componentDescriptorHeap.AddComponentDescriptors(identifier,
-			staticBufferComponents[i]);
-	}
+	const ComponentUploadInfo& uploadInfo = GetUploadInfo(identifier);
+	const std::vector<ResourceIndex>& resources =
+		uploadInfo.updatedResources.size() != 0 ?
+		uploadInfo.updatedResources : uploadInfo.liveResources;
 
-	identifier.type = ComponentType::TEXTURE2D;
-	identifier.dynamicComponent = true;
-	for (size_t i = 0; i < dynamicTexture2DComponents.size(); ++i)
-	{
-		identifier.localIndex = i;
-		componentDescriptorHeap.AddComponentDescriptors(identifier,
-			dynamicTexture2DComponents[i]);
-	}
+	for (ResourceIndex resourceIndex : resources)
+		ChangeComponentState(identifier, resourceIndex, newState, barriers);
+}
 
-	identifier.dynamicComponent = false;
-	for (size_t i = 0; i < staticTexture2DComponents.size(); ++i)
+template<FrameType Frames>
+template<typename Function>
+inline void ManagedResourceComponents<Frames>::VisitComponent(
+	const ComponentIdentifier& identifier, Function function)
+{
+	switch (identifier.type)
 	{
-		identifier.localIndex = i;
-		componentDescriptorHeap.AddComponentDescriptors(identifier,
-			staticTexture2DComponents[i]);
+	case ComponentType::BUFFER:
+		if (identifier.dynamicComponent)
+			function(dynamicBufferComponents[identifier.localIndex]);
+		else
+			function(staticBufferComponents[identifier.localIndex]);
+		break;
+	case ComponentType::TEXTURE2D:
+		if (identifier.dynamicComponent)
+			function(dynamicTexture2DComponents[identifier.localIndex]);
+		else
+			function(staticTexture2DComponents[identifier.localIndex]);
+		break;
+	default:
+		throw std::runtime_error("Attempting to visit component of unsupported type");
 	}
+}
 
-	componentDescriptorHeap.UploadCurrentFrameHeap();
-	auto heap = componentDescriptorHeap.GetShaderVisibleHeap();
-	commandList->SetDescriptorHeaps(1, &heap);
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RegisterComponent(
+	const ComponentIdentifier& identifier, const ResourceComponent& component,
+	unsigned int maxResources)
+{
+	auto& slots = GetDescriptorSlots(identifier);
+	slots.resize(identifier.localIndex + 1);
+	updateFramesLeft[GetSlotTableIndex(identifier)].resize(
+		identifier.localIndex + 1, 0);
+	copyUploadEpochs[GetSlotTableIndex(identifier)].resize(
+		identifier.localIndex + 1, 0);
+	componentGenerations[GetSlotTableIndex(identifier)].resize(
+		identifier.localIndex + 1, 0);
+	uploadInfos[GetSlotTableIndex(identifier)].resize(identifier.localIndex + 1);
+	slots[identifier.localIndex] = componentDescriptorHeap.AddComponent(
+		identifier, component, identifier.dynamicComponent, maxResources);
 }
 
 template<FrameType Frames>
-inline size_t ManagedResourceComponents<Frames>::GetComponentDescriptorStart(
-	const ComponentIdentifier& identifier, ViewType viewType)
+inline void
+ManagedResourceComponents<Frames>::Initialize(ID3D12Device* deviceToUse,
+	size_t minSizePerUploader, AllocationStrategy allocationStrategy,
+	size_t idleFramesBeforeShrink)
 {
-	return componentDescriptorHeap.GetComponentHeapOffset(identifier, viewType);
+	device = deviceToUse;
+	rtvSize = device->GetDescriptorHandleIncrementSize(
+		D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+	dsvSize = device->GetDescriptorHandleIncrementSize(
+		D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+	shaderViewSize = device->GetDescriptorHandleIncrementSize(
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	InitialiseResourceUploaders(minSizePerUploader, allocationStrategy,
+		idleFramesBeforeShrink);
+	frameArena.Initialize(1, 65536);
 }
 
 template<FrameType Frames>
-inline void ManagedResourceComponents<Frames>::SwapFrame()
+inline void ManagedResourceComponents<Frames>::FinalizeComponents(
+	size_t transientDescriptors)
 {
+	componentDescriptorHeap.Initialize(device, staticDescriptors,
+		descriptorsPerFrame, transientDescriptors);
+}
+
+template<FrameType Frames>
+inline typename ManagedResourceComponents<Frames>::ManifestHeapCategory
+ManagedResourceComponents<Frames>::GetManifestHeapCategory(
+	const ComponentManifestEntry& entry) const
+{
+	if (entry.dynamic)
+		return ManifestHeapCategory::NONE;
+
+	if (entry.type == ComponentType::BUFFER)
+	{
+		return entry.updateType == UpdateType::MAP_UPDATE ?
+			ManifestHeapCategory::UPLOAD_BUFFER : ManifestHeapCategory::BUFFER;
+	}
+
+	return entry.rtv || entry.dsv ?
+		ManifestHeapCategory::TARGET_TEXTURE : ManifestHeapCategory::TEXTURE;
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetManifestHeapSize(
+	const ComponentManifestEntry& entry) const
+{
+	size_t heapSize = entry.type == ComponentType::BUFFER ?
+		entry.maxElements * entry.elementSize : entry.totalBytes;
+
+	return D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT *
+		((heapSize + D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT - 1) /
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+}
+
+template<FrameType Frames>
+inline ID3D12Heap* ManagedResourceComponents<Frames>::CreateComponentHeap(
+	ManifestHeapCategory category, size_t heapSize)
+{
+	D3D12_HEAP_DESC desc;
+	desc.SizeInBytes = heapSize;
+	desc.Properties.Type = category == ManifestHeapCategory::UPLOAD_BUFFER ?
+		D3D12_HEAP_TYPE_UPLOAD : D3D12_HEAP_TYPE_DEFAULT;
+	desc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	desc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	desc.Properties.CreationNodeMask = 0;
+	desc.Properties.VisibleNodeMask = 0;
+	desc.Alignment = 0;
+
+	switch (category)
+	{
+	case ManifestHeapCategory::BUFFER:
+	case ManifestHeapCategory::UPLOAD_BUFFER:
+		desc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+		break;
+	case ManifestHeapCategory::TEXTURE:
+		desc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+		break;
+	default:
+		desc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+		break;
+	}
+
+	ID3D12Heap* heap = nullptr;
+	HRESULT hr = device->CreateHeap(&desc, IID_PPV_ARGS(&heap));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create heap for manifest components");
+
+	componentHeaps.push_back(D3DPtr<ID3D12Heap>(heap));
+	return heap;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::InitializeManifestComponent(
+	const ComponentManifestEntry& entry, const ComponentIdentifier& identifier,
+	const ResourceHeapInfo& heapInfo)
+{
+	if (entry.type == ComponentType::BUFFER)
+	{
+		BufferInfo bufferInfo;
+		bufferInfo.elementSize = entry.elementSize;
+		bufferInfo.alignment = entry.elementAlignment;
+		BufferComponentInfo componentInfo{ bufferInfo,
+			entry.updateType == UpdateType::MAP_UPDATE, heapInfo };
+
+		std::vector<DescriptorAllocationInfo<BufferViewDesc>> descriptorInfo =
+			CreateDefaultDAIVector<BufferViewDesc>(entry.cbv, entry.srv, entry.uav,
+				false, false, entry.maxResources);
+
+		if (entry.dynamic)
+		{
+			dynamicBufferComponents[identifier.localIndex].Initialize(device,
+				entry.updateType, componentInfo, descriptorInfo);
+		}
+		else
+		{
+			staticBufferComponents[identifier.localIndex].Initialize(device,
+				entry.updateType, componentInfo, descriptorInfo);
+		}
+	}
+	else
+	{
+		TextureComponentInfo componentInfo(entry.texelFormat, entry.texelSize,
+			heapInfo);
+
+		std::vector<DescriptorAllocationInfo<Texture2DViewDesc>> descriptorInfo =
+			CreateDefaultDAIVector<Texture2DViewDesc>(false, entry.srv, entry.uav,
+				entry.rtv, entry.dsv, entry.maxResources);
+
+		if (entry.dynamic)
+		{
+			dynamicTexture2DComponents[identifier.localIndex].Initialize(device,
+				entry.updateType, componentInfo, descriptorInfo);
+		}
+		else
+		{
+			staticTexture2DComponents[identifier.localIndex].Initialize(device,
+				entry.updateType, componentInfo, descriptorInfo);
+		}
+	}
+}
+
+template<FrameType Frames>
+inline std::vector<ComponentIdentifier>
+ManagedResourceComponents<Frames>::CreateComponents(
+	const std::vector<ComponentManifestEntry>& manifest, size_t nrOfThreads)
+{
+	std::array<size_t, 4> categorySizes = { 0, 0, 0, 0 };
+	std::vector<size_t> heapOffsets(manifest.size());
+	for (size_t i = 0; i < manifest.size(); ++i)
+	{
+		ManifestHeapCategory category = GetManifestHeapCategory(manifest[i]);
+		if (category == ManifestHeapCategory::NONE)
+			continue;
+
+		heapOffsets[i] = categorySizes[static_cast<size_t>(category)];
+		categorySizes[static_cast<size_t>(category)] +=
+			GetManifestHeapSize(manifest[i]);
+	}
+
+	std::array<ID3D12Heap*, 4> categoryHeaps = { nullptr, nullptr, nullptr, nullptr };
+	for (size_t i = 0; i < categoryHeaps.size(); ++i)
+	{
+		if (categorySizes[i] != 0)
+		{
+			categoryHeaps[i] = CreateComponentHeap(
+				static_cast<ManifestHeapCategory>(i), categorySizes[i]);
+		}
+	}
+
+	std::vector<ComponentIdentifier> toReturn;
+	std::vector<ResourceHeapInfo> heapInfos;
+	toReturn.reserve(manifest.size());
+	heapInfos.reserve(manifest.size());
+	for (size_t i = 0; i < manifest.size(); ++i)
+	{
+		const ComponentManifestEntry& entry = manifest[i];
+		ComponentIdentifier identifier = { entry.type, 0, entry.dynamic };
+
+		if (entry.type == ComponentType::BUFFER && entry.dynamic)
+		{
+			identifier.localIndex = dynamicBufferComponents.size();
+			dynamicBufferComponents.push_back(FrameBufferComponent<Frames>());
+		}
+		else if (entry.type == ComponentType::BUFFER)
+		{
+			identifier.localIndex = staticBufferComponents.size();
+			staticBufferComponents.push_back(FrameBufferComponent<1>());
+		}
+		else if (entry.type == ComponentType::TEXTURE2D && entry.dynamic)
+		{
+			identifier.localIndex = dynamicTexture2DComponents.size();
+			dynamicTexture2DComponents.push_back(FrameTexture2DComponent<Frames>());
+		}
+		else if (entry.type == ComponentType::TEXTURE2D)
+		{
+			identifier.localIndex = staticTexture2DComponents.size();
+			staticTexture2DComponents.push_back(FrameTexture2DComponent<1>());
+		}
+		else
+		{
+			throw std::runtime_error("Attempting to create component of unsupported type");
+		}
+
+		ManifestHeapCategory category = GetManifestHeapCategory(entry);
+		if (category == ManifestHeapCategory::NONE)
+		{
+			heapInfos.push_back(ResourceHeapInfo(entry.type == ComponentType::BUFFER ?
+				entry.maxElements * entry.elementSize : entry.totalBytes));
+		}
+		else
+		{
+			heapInfos.push_back(ResourceHeapInfo(
+				categoryHeaps[static_cast<size_t>(category)],
+				heapOffsets[i] + GetManifestHeapSize(entry), heapOffsets[i]));
+		}
+
+		toReturn.push_back(identifier);
+	}
+
+	nrOfThreads = std::max(nrOfThreads, size_t(1));
+	size_t entriesPerThread = (manifest.size() + nrOfThreads - 1) / nrOfThreads;
+	std::vector<std::future<void>> initializationTasks;
+	for (size_t i = 0; i < nrOfThreads; ++i)
+	{
+		size_t start = std::min(i * entriesPerThread, manifest.size());
+		size_t end = std::min(start + entriesPerThread, manifest.size());
+		initializationTasks.push_back(std::async(std::launch::async,
+			[this, &manifest, &toReturn, &heapInfos, start, end]()
+			{
+				for (size_t j = start; j < end; ++j)
+					InitializeManifestComponent(manifest[j], toReturn[j], heapInfos[j]);
+			}));
+	}
+
+	for (auto& task : initializationTasks)
+		task.wait();
+
+	for (auto& task : initializationTasks)
+		task.get();
+
+	unsigned int addedStaticDescriptors = 0;
+	unsigned int addedDescriptorsPerFrame = 0;
+	for (size_t i = 0; i < manifest.size(); ++i)
+	{
+		const ComponentManifestEntry& entry = manifest[i];
+		RegisterComponent(toReturn[i], GetComponent(toReturn[i]),
+			entry.maxResources);
+
+		ComponentUploadInfo& uploadInfo = GetUploadInfo(toReturn[i]);
+		uploadInfo.elementSize = entry.elementSize;
+		uploadInfo.alignment = entry.type == ComponentType::BUFFER ?
+			entry.elementAlignment : D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+		uploadInfo.updateType = entry.updateType;
+		uploadInfo.capacity = entry.type == ComponentType::BUFFER ?
+			entry.maxElements * entry.elementSize : entry.totalBytes;
+
+		unsigned int nrOfViews = entry.cbv + entry.srv + entry.uav +
+			entry.rtv + entry.dsv;
+		unsigned int& descriptorCount = entry.dynamic ?
+			addedDescriptorsPerFrame : addedStaticDescriptors;
+		descriptorCount += entry.maxResources * nrOfViews;
+	}
+
+	staticDescriptors += addedStaticDescriptors;
+	descriptorsPerFrame += addedDescriptorsPerFrame;
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline ComponentIdentifier
+ManagedResourceComponents<Frames>::CreateTexture2DComponent(bool dynamic,
+	size_t totalBytes, unsigned int maxNrOfTextures, std::uint8_t texelSize,
+	DXGI_FORMAT texelFormat, UpdateType componentUpdateType,
+	bool srv, bool uav, bool rtv, bool dsv)
+{
+	TextureInfo textureInfo;
+	textureInfo.format = texelFormat;
+	textureInfo.texelSize = texelSize;
+	ResourceHeapInfo heapInfo(totalBytes);
+	TextureComponentInfo componentInfo(texelFormat, texelSize, heapInfo);
+
+	std::vector<DescriptorAllocationInfo<Texture2DViewDesc>> descriptorInfo =
+		CreateDefaultDAIVector<Texture2DViewDesc>(false, srv, uav, rtv, dsv,
+			maxNrOfTextures);
+
+	ComponentIdentifier toReturn;
+	if (dynamic)
+	{
+		dynamicTexture2DComponents.push_back(FrameTexture2DComponent<Frames>());
+		dynamicTexture2DComponents.back().Initialize(device, componentUpdateType,
+			componentInfo, descriptorInfo);
+		toReturn = { ComponentType::TEXTURE2D,
+			dynamicTexture2DComponents.size() - 1, true };
+		RegisterComponent(toReturn, dynamicTexture2DComponents.back(),
+			maxNrOfTextures);
+	}
+	else
+	{
+		staticTexture2DComponents.push_back(FrameTexture2DComponent<1>());
+		staticTexture2DComponents.back().Initialize(device, componentUpdateType,
+			componentInfo, descriptorInfo);
+		toReturn = { ComponentType::TEXTURE2D,
+			staticTexture2DComponents.size() - 1, false };
+		RegisterComponent(toReturn, staticTexture2DComponents.back(),
+			maxNrOfTextures);
+	}
+
+	GetUploadInfo(toReturn).alignment = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+	GetUploadInfo(toReturn).capacity = totalBytes;
+	GetUploadInfo(toReturn).updateType = componentUpdateType;
+
+	unsigned int& descriptorCount =
+		dynamic ? descriptorsPerFrame : staticDescriptors;
+	descriptorCount += maxNrOfTextures *
+		static_cast<unsigned int>(descriptorInfo.size());
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline ComponentIdentifier
+ManagedResourceComponents<Frames>::CreateTexture2DComponent(bool dynamic,
+	size_t totalBytes, unsigned int maxNrOfTextures, std::uint8_t texelSize,
+	DXGI_FORMAT texelFormat, UpdateType componentUpdateType,
+	std::optional<Texture2DViewDesc> srv, std::optional<Texture2DViewDesc> uav,
+	std::optional<Texture2DViewDesc> rtv, std::optional<Texture2DViewDesc> dsv)
+{
+	TextureInfo textureInfo;
+	textureInfo.format = texelFormat;
+	textureInfo.texelSize = texelSize;
+	ResourceHeapInfo heapInfo(totalBytes);
+	TextureComponentInfo componentInfo(texelFormat, texelSize, heapInfo);
+
+	std::vector<DescriptorAllocationInfo<Texture2DViewDesc>> descriptorInfo =
+		CreateCustomDAIVector<Texture2DViewDesc>(std::nullopt, srv, uav, rtv,
+			dsv, maxNrOfTextures);
+
+	ComponentIdentifier toReturn;
+	if (dynamic)
+	{
+		dynamicTexture2DComponents.push_back(FrameTexture2DComponent<Frames>());
+		dynamicTexture2DComponents.back().Initialize(device, componentUpdateType,
+			componentInfo, descriptorInfo);
+		toReturn = { ComponentType::TEXTURE2D,
+			dynamicTexture2DComponents.size() - 1, true };
+		RegisterComponent(toReturn, dynamicTexture2DComponents.back(),
+			maxNrOfTextures);
+	}
+	else
+	{
+		staticTexture2DComponents.push_back(FrameTexture2DComponent<1>());
+		staticTexture2DComponents.back().Initialize(device, componentUpdateType,
+			componentInfo, descriptorInfo);
+		toReturn = { ComponentType::TEXTURE2D,
+			staticTexture2DComponents.size() - 1, false };
+		RegisterComponent(toReturn, staticTexture2DComponents.back(),
+			maxNrOfTextures);
+	}
+
+	GetUploadInfo(toReturn).alignment = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+	GetUploadInfo(toReturn).capacity = totalBytes;
+	GetUploadInfo(toReturn).updateType = componentUpdateType;
+
+	unsigned int& descriptorCount =
+		dynamic ? descriptorsPerFrame : staticDescriptors;
+	descriptorCount += maxNrOfTextures *
+		static_cast<unsigned int>(descriptorInfo.size());
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline FrameBufferComponent<Frames>&
+ManagedResourceComponents<Frames>::GetDynamicBufferComponent(
+	const ComponentIdentifier& componentIdentifier)
+{
+	MarkComponentDescriptorsChanged(componentIdentifier);
+	MarkComponentDataChanged(componentIdentifier);
+	return dynamicBufferComponents[componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline FrameBufferComponent<1>&
+ManagedResourceComponents<Frames>::GetStaticBufferComponent(
+	const ComponentIdentifier& componentIdentifier)
+{
+	MarkComponentDescriptorsChanged(componentIdentifier);
+	MarkComponentDataChanged(componentIdentifier);
+	return staticBufferComponents[componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline FrameTexture2DComponent<Frames>&
+ManagedResourceComponents<Frames>::GetDynamicTexture2DComponent(
+	const ComponentIdentifier& componentIdentifier)
+{
+	MarkComponentDescriptorsChanged(componentIdentifier);
+	MarkComponentDataChanged(componentIdentifier);
+	return dynamicTexture2DComponents[componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline FrameTexture2DComponent<1>&
+ManagedResourceComponents<Frames>::GetStaticTexture2DComponent(
+	const ComponentIdentifier& componentIdentifier)
+{
+	MarkComponentDescriptorsChanged(componentIdentifier);
+	MarkComponentDataChanged(componentIdentifier);
+	return staticTexture2DComponents[componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline ResourceIndex ManagedResourceComponents<Frames>::CreateBuffer(
+	const ComponentIdentifier& componentIdentifier, size_t nrOfElements,
+	const BufferReplacementViews& replacementViews)
+{
+	ResourceIndex toReturn = componentIdentifier.dynamicComponent ?
+		dynamicBufferComponents[componentIdentifier.localIndex].CreateBuffer(
+			nrOfElements, replacementViews) :
+		staticBufferComponents[componentIdentifier.localIndex].CreateBuffer(
+			nrOfElements, replacementViews);
+
+	if (toReturn != ResourceIndex(-1))
+	{
+		GetUploadInfo(componentIdentifier).liveResources.push_back(toReturn);
+		AddPendingUploadBytes(componentIdentifier,
+			nrOfElements * GetUploadInfo(componentIdentifier).elementSize);
+		MarkComponentDescriptorsChanged(componentIdentifier);
+		MarkComponentDataChanged(componentIdentifier);
+	}
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline ResourceIndex ManagedResourceComponents<Frames>::CreateTexture(
+	const ComponentIdentifier& componentIdentifier,
+	const TextureAllocationInfo& allocationInfo,
+	const Texture2DComponentTemplate::TextureReplacementViews& replacementViews)
+{
+	ResourceIndex toReturn = componentIdentifier.dynamicComponent ?
+		dynamicTexture2DComponents[componentIdentifier.localIndex].CreateTexture(
+			allocationInfo, replacementViews) :
+		staticTexture2DComponents[componentIdentifier.localIndex].CreateTexture(
+			allocationInfo, replacementViews);
+
+	if (toReturn != ResourceIndex(-1))
+	{
+		ComponentUploadInfo& uploadInfo = GetUploadInfo(componentIdentifier);
+		uploadInfo.liveResources.push_back(toReturn);
+		uploadInfo.updatedResources.push_back(toReturn);
+
+		ID3D12Resource* resource = componentIdentifier.dynamicComponent ?
+			dynamicTexture2DComponents[componentIdentifier.localIndex].GetTextureHandle(
+				toReturn).resource :
+			staticTexture2DComponents[componentIdentifier.localIndex].GetTextureHandle(
+				toReturn).resource;
+		D3D12_RESOURCE_DESC desc = resource->GetDesc();
+		UINT64 nrOfBytes = 0;
+		device->GetCopyableFootprints(&desc, 0, desc.MipLevels * desc.DepthOrArraySize,
+			0, nullptr, nullptr, nullptr, &nrOfBytes);
+		AddPendingUploadBytes(componentIdentifier, static_cast<size_t>(nrOfBytes));
+		MarkComponentDescriptorsChanged(componentIdentifier);
+		MarkComponentDataChanged(componentIdentifier);
+	}
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RemoveResource(
+	const ComponentIdentifier& componentIdentifier, ResourceIndex indexToRemove)
+{
+	GetComponent(componentIdentifier).RemoveComponent(indexToRemove);
+	MarkComponentDescriptorsChanged(componentIdentifier);
+
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(componentIdentifier);
+	auto& liveResources = uploadInfo.liveResources;
+	liveResources.erase(std::remove(liveResources.begin(), liveResources.end(),
+		indexToRemove), liveResources.end());
+	auto& updatedResources = uploadInfo.updatedResources;
+	updatedResources.erase(std::remove(updatedResources.begin(),
+		updatedResources.end(), indexToRemove), updatedResources.end());
+	auto& initialisedResources = uploadInfo.initialisedResources;
+	initialisedResources.erase(std::remove_if(initialisedResources.begin(),
+		initialisedResources.end(), [indexToRemove](const auto& initialised)
+		{
+			return initialised.first == indexToRemove;
+		}), initialisedResources.end());
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::MarkComponentDescriptorsChanged(
+	const ComponentIdentifier& componentIdentifier)
+{
+	componentDescriptorHeap.MarkComponentChanged(
+		GetDescriptorSlots(componentIdentifier)[componentIdentifier.localIndex]);
+	++componentGenerations[GetSlotTableIndex(componentIdentifier)][
+		componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline std::uint64_t ManagedResourceComponents<Frames>::GetComponentGeneration(
+	const ComponentIdentifier& componentIdentifier) const
+{
+	return componentGenerations[GetSlotTableIndex(componentIdentifier)][
+		componentIdentifier.localIndex];
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetBufferUpdateData(
+	const ComponentIdentifier& componentIdentifier, ResourceIndex resourceIndex,
+	void* dataAdress)
+{
+	size_t nrOfElements = 0;
+	if (componentIdentifier.dynamicComponent)
+	{
+		auto& component = dynamicBufferComponents[componentIdentifier.localIndex];
+		component.SetUpdateData(resourceIndex, dataAdress);
+		nrOfElements = component.GetBufferHandle(resourceIndex).nrOfElements;
+	}
+	else
+	{
+		auto& component = staticBufferComponents[componentIdentifier.localIndex];
+		component.SetUpdateData(resourceIndex, dataAdress);
+		nrOfElements = component.GetBufferHandle(resourceIndex).nrOfElements;
+	}
+
+	size_t nrOfBytes = nrOfElements * GetUploadInfo(componentIdentifier).elementSize;
+	AddPendingUploadBytes(componentIdentifier, nrOfBytes);
+	RecordInitialisedBytes(componentIdentifier, resourceIndex, nrOfBytes);
+	MarkComponentDataChanged(componentIdentifier);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetTextureUpdateData(
+	const ComponentIdentifier& componentIdentifier, ResourceIndex resourceIndex,
+	void* dataAdress, std::uint8_t subresource)
+{
+	ID3D12Resource* resource = nullptr;
+	if (componentIdentifier.dynamicComponent)
+	{
+		auto& component = dynamicTexture2DComponents[componentIdentifier.localIndex];
+		component.SetUpdateData(resourceIndex, dataAdress, subresource);
+		resource = component.GetTextureHandle(resourceIndex).resource;
+	}
+	else
+	{
+		auto& component = staticTexture2DComponents[componentIdentifier.localIndex];
+		component.SetUpdateData(resourceIndex, dataAdress, subresource);
+		resource = component.GetTextureHandle(resourceIndex).resource;
+	}
+
+	auto& updatedResources = GetUploadInfo(componentIdentifier).updatedResources;
+	if (std::find(updatedResources.begin(), updatedResources.end(),
+		resourceIndex) == updatedResources.end())
+	{
+		updatedResources.push_back(resourceIndex);
+	}
+
+	D3D12_RESOURCE_DESC desc = resource->GetDesc();
+	UINT64 nrOfBytes = 0;
+	device->GetCopyableFootprints(&desc, subresource, 1, 0, nullptr, nullptr,
+		nullptr, &nrOfBytes);
+	AddPendingUploadBytes(componentIdentifier, static_cast<size_t>(nrOfBytes));
+	RecordInitialisedBytes(componentIdentifier, resourceIndex,
+		static_cast<size_t>(nrOfBytes));
+	MarkComponentDataChanged(componentIdentifier);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::MarkComponentDataChanged(
+	const ComponentIdentifier& componentIdentifier)
+{
+	FrameType& framesLeft = GetUpdateFramesLeft(componentIdentifier);
+	ComponentUploadInfo& uploadInfo = GetUploadInfo(componentIdentifier);
+
+	// Map updated components live in upload heaps and must stay readable, so
+	// they are always updated on the direct queue
+	bool useCopyQueue = copyQueueUploads && !componentIdentifier.dynamicComponent &&
+		uploadInfo.updateType != UpdateType::MAP_UPDATE;
+
+	if (uploadInfo.pendingBytes == 0)
+	{
+		uploadInfo.pendingBytes = uploadInfo.capacity;
+		uploadInfo.pendingResources = uploadInfo.liveResources.size();
+	}
+
+	if (framesLeft == 0)
+	{
+		if (useCopyQueue)
+			copyComponentsToUpdate.push_back(componentIdentifier);
+		else
+			componentsToUpdate.push_back(componentIdentifier);
+	}
+
+	framesLeft = componentIdentifier.dynamicComponent ? Frames : 1;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetUploadBudget(
+	size_t bytesPerFrame)
+{
+	uploadBudget = bytesPerFrame;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetComponentUploadPriority(
+	const ComponentIdentifier& componentIdentifier, std::uint8_t priority)
+{
+	GetUploadInfo(componentIdentifier).priority = priority;
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetUploadedBytesThisFrame() const
+{
+	return uploadedBytesThisFrame;
+}
+
+template<FrameType Frames>
+inline size_t
+ManagedResourceComponents<Frames>::GetNrOfDeferredUpdatesThisFrame() const
+{
+	return deferredUpdatesThisFrame;
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetUploadMemoryCapacity() const
+{
+	size_t toReturn = 0;
+	for (FrameType i = 0; i < Frames; ++i)
+		toReturn += uploaders[i].GetCapacity();
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetPeakUploadMemoryUsage() const
+{
+	size_t toReturn = 0;
+	for (FrameType i = 0; i < Frames; ++i)
+		toReturn = std::max(toReturn, uploaders[i].GetPeakUsage());
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetComponentUsageState(
+	const ComponentIdentifier& componentIdentifier,
+	D3D12_RESOURCE_STATES usageState)
+{
+	GetUploadInfo(componentIdentifier).usageState = usageState;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::TransitionComponent(
+	const ComponentIdentifier& componentIdentifier,
+	D3D12_RESOURCE_STATES newState, ResourceIndex resourceIndex)
+{
+	ChangeComponentState(componentIdentifier, resourceIndex, newState);
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::FlushResourceBarriers(
+	ID3D12GraphicsCommandList* commandList)
+{
+	stateTracker.EndSplitBarriers(commandList);
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetNrOfSavedBarriers() const
+{
+	return stateTracker.GetNrOfSavedBarriers();
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::InitializeDirectWrites(
+	size_t bytesPerFrame)
+{
+	for (FrameType i = 0; i < Frames; ++i)
+		directWriteBuffers[i].Initialize(device, bytesPerFrame);
+}
+
+template<FrameType Frames>
+inline void* ManagedResourceComponents<Frames>::BeginBufferWrite(
+	const ComponentIdentifier& componentIdentifier, ResourceIndex resourceIndex)
+{
+	if (componentIdentifier.type != ComponentType::BUFFER)
+		throw std::runtime_error("Direct writes are only supported for buffer components");
+
+	BufferHandle handle = componentIdentifier.dynamicComponent ?
+		dynamicBufferComponents[componentIdentifier.localIndex].GetBufferHandle(
+			resourceIndex) :
+		staticBufferComponents[componentIdentifier.localIndex].GetBufferHandle(
+			resourceIndex);
+	const ComponentUploadInfo& uploadInfo = GetUploadInfo(componentIdentifier);
+	size_t nrOfBytes = handle.nrOfElements * uploadInfo.elementSize;
+
+	if (uploadInfo.updateType == UpdateType::MAP_UPDATE)
+	{
+		// A static buffer is shared by every frame in flight
+		if (!componentIdentifier.dynamicComponent)
+			throw std::runtime_error("Could not write directly to a static map updated buffer");
+
+		auto mapped = std::find_if(mappedWriteResources.begin(),
+			mappedWriteResources.end(), [&handle](MappedWriteResource& entry)
+			{
+				return entry.resource.Get() == handle.resource;
+			});
+
+		if (mapped == mappedWriteResources.end())
+		{
+			unsigned char* mappedPtr = nullptr;
+			D3D12_RANGE nothingToRead = { 0, 0 };
+			HRESULT hr = handle.resource->Map(0, &nothingToRead,
+				reinterpret_cast<void**>(&mappedPtr));
+			if (FAILED(hr))
+				throw std::runtime_error("Could not map buffer for direct write");
+
+			handle.resource->AddRef();
+			mappedWriteResources.push_back({ handle.resource, mappedPtr });
+			mapped = mappedWriteResources.end() - 1;
+		}
+
+		return mapped->mappedPtr + handle.startOffset;
+	}
+	else if (uploadInfo.updateType != UpdateType::COPY_UPDATE)
+	{
+		throw std::runtime_error("Direct writes require a map or copy updated component");
+	}
+	else if (componentIdentifier.dynamicComponent)
+	{
+		// Only the active frame's copy would be written
+		throw std::runtime_error("Could not write directly to a dynamic copy updated buffer");
+	}
+
+	LinearUploadBuffer& writeBuffer = directWriteBuffers[this->activeFrame];
+	if (writeBuffer.GetSize() == 0)
+		return nullptr;
+
+	size_t sourceOffset = writeBuffer.Allocate(nrOfBytes, 16);
+	if (sourceOffset == size_t(-1))
+		return nullptr;
+
+	DirectBufferWrite toStore;
+	toStore.identifier = componentIdentifier;
+	toStore.resource = handle.resource;
+	toStore.destinationOffset = handle.startOffset;
+	toStore.sourceOffset = sourceOffset;
+	toStore.nrOfBytes = nrOfBytes;
+	directBufferWrites.push_back(toStore);
+
+	return writeBuffer.GetMappedPtr(sourceOffset);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RecordBufferWrites(
+	ID3D12GraphicsCommandList* commandList)
+{
+	if (directBufferWrites.size() == 0)
+		return;
+
+	for (auto& write : directBufferWrites)
+	{
+		ChangeComponentState(write.identifier, 0,
+			D3D12_RESOURCE_STATE_COPY_DEST);
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.FlushBarriers(commandList);
+
+	ID3D12Resource* source = directWriteBuffers[this->activeFrame].GetResource();
+	for (auto& write : directBufferWrites)
+	{
+		commandList->CopyBufferRegion(write.resource, write.destinationOffset,
+			source, write.sourceOffset, write.nrOfBytes);
+	}
+
+	for (auto& write : directBufferWrites)
+	{
+		const ComponentUploadInfo& uploadInfo = GetUploadInfo(write.identifier);
+		if (uploadInfo.usageState.has_value())
+		{
+			ChangeComponentState(write.identifier, 0,
+				uploadInfo.usageState.value());
+		}
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.BeginSplitBarriers(commandList);
+	directBufferWrites.clear();
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::InitializeScatterUpdates(
+	const std::string& shaderPath, size_t bytesPerFrame)
+{
+	scatterPipeline.Initialize(device, shaderPath);
+
+	for (FrameType i = 0; i < Frames; ++i)
+		scatterUploadBuffers[i].Initialize(device, bytesPerFrame);
+}
+
+template<FrameType Frames>
+inline bool ManagedResourceComponents<Frames>::ScatterBufferUpdates(
+	const ComponentIdentifier& componentIdentifier, ResourceIndex resourceIndex,
+	const ScatterUpdateBatcher& batcher)
+{
+	if (componentIdentifier.type != ComponentType::BUFFER)
+		throw std::runtime_error("Scatter updates are only supported for buffer components");
+
+	// Only the active frame's copy of a dynamic buffer would be written
+	if (componentIdentifier.dynamicComponent)
+		throw std::runtime_error("Scatter updates are only supported for static components");
+
+	if (!GetComponent(componentIdentifier).HasDescriptorsOfType(ViewType::UAV))
+		throw std::runtime_error("Scatter updates require a component with UAV access");
+
+	if (batcher.NrOfUpdates() == 0)
+		return true;
+
+	BufferHandle handle = staticBufferComponents[
+		componentIdentifier.localIndex].GetBufferHandle(resourceIndex);
+
+	if (batcher.GetElementStride() != GetUploadInfo(componentIdentifier).elementSize)
+		throw std::runtime_error("Scatter update stride does not match component");
+
+	if (batcher.GetHighestIndex() >= handle.nrOfElements)
+		throw std::runtime_error("Scatter update index is outside of resource");
+
+	LinearUploadBuffer& scatterBuffer = scatterUploadBuffers[this->activeFrame];
+	if (scatterBuffer.GetSize() == 0)
+		return false;
+
+	size_t sourceOffset = scatterBuffer.Allocate(batcher.GetPackedSize(),
+		D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+	if (sourceOffset == size_t(-1))
+		return false;
+
+	std::memcpy(scatterBuffer.GetMappedPtr(sourceOffset), batcher.GetPackedData(),
+		batcher.GetPackedSize());
+
+	ScatterBufferUpdate toStore;
+	toStore.identifier = componentIdentifier;
+	toStore.resource = handle.resource;
+	toStore.target = handle.resource->GetGPUVirtualAddress() + handle.startOffset;
+	toStore.sourceOffset = sourceOffset;
+	toStore.nrOfUpdates = static_cast<UINT>(batcher.NrOfUpdates());
+	toStore.elementStride = static_cast<UINT>(batcher.GetElementStride());
+	scatterBufferUpdates.push_back(toStore);
+	copyCommandsSavedThisFrame += batcher.NrOfContiguousRuns() - 1;
+
+	return true;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RecordScatterUpdates(
+	ID3D12GraphicsCommandList* commandList)
+{
+	if (scatterBufferUpdates.size() == 0)
+		return;
+
+	for (auto& update : scatterBufferUpdates)
+	{
+		ChangeComponentState(update.identifier, 0,
+			D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.FlushBarriers(commandList);
+
+	D3D12_GPU_VIRTUAL_ADDRESS source =
+		scatterUploadBuffers[this->activeFrame].GetResource()->GetGPUVirtualAddress();
+	scatterPipeline.SetPipelineState(commandList);
+	scatteredResources.clear();
+	for (auto& update : scatterBufferUpdates)
+	{
+		// Dispatches into the same resource are not ordered without a UAV barrier
+		if (std::find(scatteredResources.begin(), scatteredResources.end(),
+			update.resource) != scatteredResources.end())
+		{
+			D3D12_RESOURCE_BARRIER barrier;
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+			barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+			barrier.UAV.pResource = update.resource;
+			commandList->ResourceBarrier(1, &barrier);
+		}
+		else
+		{
+			scatteredResources.push_back(update.resource);
+		}
+
+		scatterPipeline.Dispatch(commandList, source + update.sourceOffset,
+			update.target, update.nrOfUpdates, update.elementStride);
+	}
+
+	for (auto& update : scatterBufferUpdates)
+	{
+		const ComponentUploadInfo& uploadInfo = GetUploadInfo(update.identifier);
+		if (uploadInfo.usageState.has_value())
+		{
+			ChangeComponentState(update.identifier, 0,
+				uploadInfo.usageState.value());
+		}
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.BeginSplitBarriers(commandList);
+	scatterBufferUpdates.clear();
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetCopyCommandsSavedThisFrame() const
+{
+	return copyCommandsSavedThisFrame;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SetUploadCompletedCallback(
+	const std::function<void(const ComponentIdentifier&)>& callback)
+{
+	uploadCompletedCallback = callback;
+}
+
+template<FrameType Frames>
+inline bool ManagedResourceComponents<Frames>::IsComponentUploadComplete(
+	const ComponentIdentifier& componentIdentifier)
+{
+	return GetUpdateFramesLeft(componentIdentifier) == 0 &&
+		!GetUploadInfo(componentIdentifier).awaitingCompletion;
+}
+
+template<FrameType Frames>
+inline ComponentMemoryInfo ManagedResourceComponents<Frames>::GetComponentMemoryInfo(
+	const ComponentIdentifier& componentIdentifier)
+{
+	const ComponentUploadInfo& uploadInfo = GetUploadInfo(componentIdentifier);
+	ComponentMemoryInfo toReturn;
+	toReturn.gpuBytes = uploadInfo.capacity *
+		(componentIdentifier.dynamicComponent ? Frames : 1);
+
+	switch (uploadInfo.updateType)
+	{
+	case UpdateType::INITIALISE_ONLY:
+		for (auto& initialised : uploadInfo.initialisedResources)
+			toReturn.cpuBytes += initialised.second;
+		break;
+	case UpdateType::MAP_UPDATE:
+	case UpdateType::COPY_UPDATE:
+		toReturn.cpuBytes = uploadInfo.capacity;
+		break;
+	default:
+		break;
+	}
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline std::vector<std::pair<ComponentIdentifier, ComponentMemoryInfo>>
+ManagedResourceComponents<Frames>::GetComponentMemoryReport()
+{
+	std::vector<std::pair<ComponentIdentifier, ComponentMemoryInfo>> toReturn;
+
+	for (size_t i = 0; i < uploadInfos.size(); ++i)
+	{
+		for (size_t j = 0; j < uploadInfos[i].size(); ++j)
+		{
+			ComponentIdentifier identifier = { static_cast<ComponentType>(i / 2),
+				j, i % 2 == 1 };
+			toReturn.push_back({ identifier, GetComponentMemoryInfo(identifier) });
+		}
+	}
+
+	std::sort(toReturn.begin(), toReturn.end(), [](const auto& a, const auto& b)
+		{
+			return a.second.cpuBytes + a.second.gpuBytes >
+				b.second.cpuBytes + b.second.gpuBytes;
+		});
+
+	return toReturn;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::UpdateComponents(
+	ID3D12GraphicsCommandList* commandList)
+{
+	PrepareCopyQueueUploads(commandList);
+	size_t nrOfScheduled = ScheduleUpdates(componentsToUpdate);
+
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		VisitComponent(componentsToUpdate[i], [this](auto& component)
+			{
+				component.PrepareResourcesForUpdates(updateBarriers);
+			});
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.FlushBarriers(commandList);
+
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		ResourceUploader& uploader = uploaders[this->activeFrame].GetUploader(
+			GetUploadEstimate(componentsToUpdate[i]));
+		VisitComponent(componentsToUpdate[i], [commandList, &uploader](
+			auto& component)
+			{
+				component.PerformUpdates(commandList, uploader);
+			});
+	}
+
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		const ComponentUploadInfo& uploadInfo = GetUploadInfo(componentsToUpdate[i]);
+		if (uploadInfo.usageState.has_value())
+		{
+			ChangeUpdatedResourcesState(componentsToUpdate[i],
+				uploadInfo.usageState.value());
+		}
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.BeginSplitBarriers(commandList);
+
+	FinishScheduledUpdates(componentsToUpdate, nrOfScheduled);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::InitializeUpdateWorkers(
+	size_t nrOfWorkers, size_t minSizePerUploader,
+	AllocationStrategy allocationStrategy)
+{
+	size_t sizePerUploader = 65536 *
+		static_cast<size_t>(std::ceil((1.0 * minSizePerUploader) / 65536));
+
+	nrOfUpdateWorkers = nrOfWorkers;
+	workerBarriers.resize(nrOfWorkers);
+	frameArena.Initialize(nrOfWorkers + 1, 65536);
+	workerPool = std::make_unique<UpdateWorkerPool>();
+	workerPool->Initialize(nrOfWorkers);
+
+	for (size_t i = 0; i < Frames * nrOfWorkers; ++i)
+	{
+		workerAllocators.push_back(std::make_unique<ManagedCommandAllocator>());
+		workerAllocators.back()->Initialize(device, D3D12_COMMAND_LIST_TYPE_DIRECT);
+		workerUploaders.push_back(ResourceUploader());
+		workerUploaders.back().Initialize(device, sizePerUploader,
+			allocationStrategy);
+	}
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RecordWorkerUpdates(
+	size_t workerIndex, size_t start, size_t end)
+{
+	size_t frameWorkerIndex = this->activeFrame * nrOfUpdateWorkers + workerIndex;
+	ManagedCommandAllocator& allocator = *workerAllocators[frameWorkerIndex];
+	ResourceUploader& uploader = workerUploaders[frameWorkerIndex];
+	auto& barriers = workerBarriers[workerIndex];
+
+	allocator.Reset();
+	ID3D12GraphicsCommandList* commandList = allocator.ActiveList();
+
+	for (size_t i = start; i < end; ++i)
+	{
+		VisitComponent(componentsToUpdate[i], [&barriers](auto& component)
+			{
+				component.PrepareResourcesForUpdates(barriers);
+			});
+	}
+
+	if (barriers.size() != 0)
+	{
+		commandList->ResourceBarrier(static_cast<UINT>(barriers.size()),
+			barriers.data());
+		barriers.clear();
+	}
+
+	for (size_t i = start; i < end; ++i)
+	{
+		VisitComponent(componentsToUpdate[i], [commandList, &uploader](
+			auto& component)
+			{
+				component.PerformUpdates(commandList, uploader);
+			});
+	}
+
+	// Each worker owns its components, so the usage states can be restored on
+	// its own list without going through the shared state tracker
+	for (size_t i = start; i < end; ++i)
+	{
+		const ComponentUploadInfo& uploadInfo = GetUploadInfo(componentsToUpdate[i]);
+		if (uploadInfo.usageState.has_value())
+		{
+			ChangeUpdatedResourcesState(componentsToUpdate[i],
+				uploadInfo.usageState.value(), barriers);
+		}
+	}
+
+	if (barriers.size() != 0)
+	{
+		commandList->ResourceBarrier(static_cast<UINT>(barriers.size()),
+			barriers.data());
+		barriers.clear();
+	}
+
+	allocator.FinishActiveList();
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RecordWorkerUpdatesJob(
+	void* context, size_t workerIndex)
+{
+	auto* components = static_cast<ManagedResourceComponents<Frames>*>(context);
+	size_t componentsPerWorker = (components->nrOfParallelUpdates +
+		components->nrOfUpdateWorkers - 1) / components->nrOfUpdateWorkers;
+	size_t start = std::min(workerIndex * componentsPerWorker,
+		components->nrOfParallelUpdates);
+	size_t end = std::min(start + componentsPerWorker,
+		components->nrOfParallelUpdates);
+
+	components->RecordWorkerUpdates(workerIndex, start, end);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::UpdateComponentsParallel()
+{
+	if (nrOfUpdateWorkers == 0)
+		throw std::runtime_error("No update workers have been initialized");
+
+	nrOfParallelUpdates = ScheduleUpdates(componentsToUpdate);
+	size_t nrOfScheduled = nrOfParallelUpdates;
+	workerPool->Run(&ManagedResourceComponents<Frames>::RecordWorkerUpdatesJob,
+		this);
+	workerListsRecorded = true;
+
+	FinishScheduledUpdates(componentsToUpdate, nrOfScheduled);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::ExecuteUpdateLists(
+	ID3D12CommandQueue* queue)
+{
+	if (!workerListsRecorded)
+		return;
+
+	for (size_t i = 0; i < nrOfUpdateWorkers; ++i)
+	{
+		workerAllocators[this->activeFrame * nrOfUpdateWorkers + i]->
+			ExecuteCommands(queue);
+	}
+
+	workerListsRecorded = false;
+}
+
+template<FrameType Frames>
+template<typename T>
+inline ArenaAllocator<T> ManagedResourceComponents<Frames>::GetFrameAllocator(
+	size_t threadIndex)
+{
+	return frameArena.template GetAllocator<T>(threadIndex);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::InitializeCopyQueueUploads(
+	size_t minSizePerUploader, AllocationStrategy allocationStrategy)
+{
+	size_t sizePerUploader = 65536 *
+		static_cast<size_t>(std::ceil((1.0 * minSizePerUploader) / 65536));
+
+	copyAllocators = std::make_unique<ManagedCommandAllocator[]>(Frames);
+	copyFences = std::make_unique<ManagedFence[]>(Frames);
+	copyUploaders = std::make_unique<ResourceUploader[]>(Frames);
+
+	for (FrameType i = 0; i < Frames; ++i)
+	{
+		copyAllocators[i].Initialize(device, D3D12_COMMAND_LIST_TYPE_COPY);
+		copyFences[i].Initialize(device);
+		copyUploaders[i].Initialize(device, sizePerUploader, allocationStrategy);
+	}
+
+	directQueueFence.Initialize(device);
+	copyQueueUploads = true;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::PrepareCopyQueueUploads(
+	ID3D12GraphicsCommandList* commandList)
+{
+	if (!copyQueueUploads || nrOfPreparedCopyUpdates != 0 ||
+		copyComponentsToUpdate.size() == 0)
+	{
+		return;
+	}
+
+	nrOfPreparedCopyUpdates = ScheduleUpdates(copyComponentsToUpdate);
+	for (size_t i = 0; i < nrOfPreparedCopyUpdates; ++i)
+	{
+		ChangeUpdatedResourcesState(copyComponentsToUpdate[i],
+			D3D12_RESOURCE_STATE_COMMON);
+	}
+
+	stateTracker.AddBarriers(updateBarriers);
+	updateBarriers.clear();
+	stateTracker.FlushBarriers(commandList);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::UpdateComponentsCopyQueue(
+	ID3D12CommandQueue* copyQueue, ID3D12CommandQueue* directQueue)
+{
+	if (nrOfPreparedCopyUpdates == 0)
+		return;
+
+	FrameType frame = this->activeFrame;
+	copyFences[frame].WaitCPU();
+	copyUploaders[frame].RestoreUsedMemory();
+	copyAllocators[frame].Reset();
+	ID3D12GraphicsCommandList* commandList = copyAllocators[frame].ActiveList();
+	size_t nrOfScheduled = nrOfPreparedCopyUpdates;
+	nrOfPreparedCopyUpdates = 0;
+
+	// The copy queue promotes the common resources to copy destinations by
+	// itself, so the barriers only serve to keep the tracked states in sync
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		VisitComponent(copyComponentsToUpdate[i], [this](auto& component)
+			{
+				component.PrepareResourcesForUpdates(updateBarriers);
+			});
+	}
+
+	updateBarriers.clear();
+
+	++currentCopyEpoch;
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		const ComponentIdentifier& identifier = copyComponentsToUpdate[i];
+		VisitComponent(identifier, [this, commandList, frame](auto& component)
+			{
+				component.PerformUpdates(commandList, copyUploaders[frame]);
+			});
+
+		copyUploadEpochs[GetSlotTableIndex(identifier)][identifier.localIndex] =
+			currentCopyEpoch;
+	}
+
+	// Resources used on the copy queue decay to common once it is done with them
+	for (size_t i = 0; i < nrOfScheduled; ++i)
+	{
+		ChangeUpdatedResourcesState(copyComponentsToUpdate[i],
+			D3D12_RESOURCE_STATE_COMMON);
+	}
+
+	updateBarriers.clear();
+
+	FinishScheduledUpdates(copyComponentsToUpdate, nrOfScheduled);
+	copyAllocators[frame].FinishActiveList();
+	directQueueFence.Signal(directQueue);
+	directQueueFence.WaitGPU(copyQueue);
+	copyAllocators[frame].ExecuteCommands(copyQueue);
+	copyFences[frame].Signal(copyQueue);
+	copyFrameEpochs[frame] = currentCopyEpoch;
+	lastCopyFrame = frame;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::RequireComponentData(
+	const ComponentIdentifier& componentIdentifier,
+	ID3D12CommandQueue* consumerQueue)
+{
+	size_t epoch = copyUploadEpochs[GetSlotTableIndex(componentIdentifier)][
+		componentIdentifier.localIndex];
+
+	if (epoch > waitedCopyEpoch)
+		WaitForCopyQueueUploads(consumerQueue);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::WaitForCopyQueueUploads(
+	ID3D12CommandQueue* consumerQueue)
+{
+	if (currentCopyEpoch == waitedCopyEpoch)
+		return;
+
+	copyFences[lastCopyFrame].WaitGPU(consumerQueue);
+	waitedCopyEpoch = currentCopyEpoch;
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::BindComponents(
+	ID3D12GraphicsCommandList* commandList, ID3D12DescriptorHeap* samplerHeap)
+{
+	for (size_t slot : componentDescriptorHeap.GetChangedComponents())
+	{
+		componentDescriptorHeap.UpdateComponentDescriptors(slot, GetComponent(
+			componentDescriptorHeap.GetComponentIdentifier(slot)));
+	}
+
+	componentDescriptorHeap.UploadCurrentFrameHeap();
+	ID3D12DescriptorHeap* heaps[] = 
+		{ componentDescriptorHeap.GetShaderVisibleHeap(), samplerHeap };
+	commandList->SetDescriptorHeaps(samplerHeap != nullptr ? 2 : 1, heaps);
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetComponentDescriptorStart(
+	const ComponentIdentifier& identifier, ViewType viewType)
+{
+	return componentDescriptorHeap.GetComponentHeapOffset(
+		GetDescriptorSlots(identifier)[identifier.localIndex], viewType);
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::GetDescriptorsCopiedLastFrame() const
+{
+	return componentDescriptorHeap.GetDescriptorsCopiedLastUpload();
+}
+
+template<FrameType Frames>
+inline size_t ManagedResourceComponents<Frames>::AllocateTransientDescriptors(
+	size_t nrOfDescriptors)
+{
+	return componentDescriptorHeap.AllocateTransientDescriptors(nrOfDescriptors);
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::CopyToTransientDescriptors(
+	size_t heapOffset, D3D12_CPU_DESCRIPTOR_HANDLE sourceHandle,
+	UINT nrOfDescriptors)
+{
+	componentDescriptorHeap.CopyToTransientDescriptors(heapOffset, sourceHandle,
+		nrOfDescriptors);
+}
+
+template<FrameType Frames>
+inline std::uint64_t ManagedResourceComponents<Frames>::GetTransientWrapCount() const
+{
+	return componentDescriptorHeap.GetTransientWrapCount();
+}
+
+template<FrameType Frames>
+inline void ManagedResourceComponents<Frames>::SwapFrame()
+{
+	if (stateTracker.HasSplitBarriers())
+		throw std::runtime_error("Could not swap frame with open split barriers");
+
 	FrameBased<Frames>::SwapFrame();
 
 	uploaders[this->activeFrame].RestoreUsedMemory();
+	directWriteBuffers[this->activeFrame].Reset();
+	directBufferWrites.clear();
+	scatterUploadBuffers[this->activeFrame].Reset();
+	scatterBufferUpdates.clear();
+	for (size_t i = 0; i < nrOfUpdateWorkers; ++i)
+		workerUploaders[this->activeFrame * nrOfUpdateWorkers + i].RestoreUsedMemory();
 
 	for (auto& bufferComponent : dynamicBufferComponents)
 		bufferComponent.SwapFrame();
@@ -572,4 +2373,10 @@ inline void ManagedResourceComponents<Frames>::SwapFrame()
 		texture2DComponent.SwapFrame();
 
 	componentDescriptorHeap.SwapFrame();
+	frameArena.SwapFrame();
+	uploadedBytesThisFrame = 0;
+	deferredUpdatesThisFrame = 0;
+	copyCommandsSavedThisFrame = 0;
+	++frameCounter;
+	ProcessCompletedUploads();
 }
@@ -0,0 +1,52 @@
+#include "ManagedSamplerHeap.h"
+
+#include <stdexcept>
+
+void ManagedSamplerHeap::Initialize(ID3D12Device* deviceToUse,
+	size_t maxNrOfSamplers)
+{
+	device = deviceToUse;
+	maxSamplers = maxNrOfSamplers;
+	descriptorSize = device->GetDescriptorHandleIncrementSize(
+		D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+
+	D3D12_DESCRIPTOR_HEAP_DESC desc;
+	desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER;
+	desc.NumDescriptors = static_cast<UINT>(maxSamplers);
+	desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+	desc.NodeMask = 0;
+
+	HRESULT hr = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&heap));
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create sampler descriptor heap");
+}
+
+size_t ManagedSamplerHeap::GetSamplerIndex(const D3D12_SAMPLER_DESC& desc)
+{
+	std::string key(reinterpret_cast<const char*>(&desc), sizeof(desc));
+	auto result = samplerLookup.find(key);
+
+	if (result != samplerLookup.end())
+		return result->second;
+
+	if (samplerLookup.size() == maxSamplers)
+		throw std::runtime_error("Sampler descriptor heap is full");
+
+	size_t toReturn = samplerLookup.size();
+	D3D12_CPU_DESCRIPTOR_HANDLE handle = heap->GetCPUDescriptorHandleForHeapStart();
+	handle.ptr += toReturn * descriptorSize;
+	device->CreateSampler(&desc, handle);
+	samplerLookup[key] = toReturn;
+
+	return toReturn;
+}
+
+ID3D12DescriptorHeap* ManagedSamplerHeap::GetShaderVisibleHeap()
+{
+	return heap;
+}
+
+size_t ManagedSamplerHeap::NrOfSamplers() const
+{
+	return samplerLookup.size();
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <d3d12.h>
+#include <string>
+#include <unordered_map>
+
+#include "D3DPtr.h"
+
+class ManagedSamplerHeap
+{
+private:
+	ID3D12Device* device = nullptr;
+	D3DPtr<ID3D12DescriptorHeap> heap;
+	size_t descriptorSize = 0;
+	size_t maxSamplers = 0;
+	std::unordered_map<std::string, size_t> samplerLookup;
+
+public:
+	ManagedSamplerHeap() = default;
+	~ManagedSamplerHeap() = default;
+	ManagedSamplerHeap(const ManagedSamplerHeap& other) = delete;
+	ManagedSamplerHeap& operator=(const ManagedSamplerHeap& other) = delete;
+	ManagedSamplerHeap(ManagedSamplerHeap&& other) = default;
+	ManagedSamplerHeap& operator=(ManagedSamplerHeap&& other) = default;
+
+	void Initialize(ID3D12Device* deviceToUse,
+		size_t maxNrOfSamplers = D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE);
+
+	size_t GetSamplerIndex(const D3D12_SAMPLER_DESC& desc);
+
+	ID3D12DescriptorHeap* GetShaderVisibleHeap();
+	size_t NrOfSamplers() const;
+};
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "ResourceStateTracker.h"
+
+#include <stdexcept>
+
+bool ResourceStateTracker::ReferencesResource(
+	const D3D12_RESOURCE_BARRIER& barrier, ID3D12Resource* resource) const
+{
+	switch (barrier.Type)
+	{
+	case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
+		return barrier.Transition.pResource == resource;
+	case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
+		return barrier.Aliasing.pResourceBefore == resource ||
+			barrier.Aliasing.pResourceAfter == resource;
+	case D3D12_RESOURCE_BARRIER_TYPE_UAV:
+		return barrier.UAV.pResource == resource;
+	default:
+		return true;
+	}
+}
+
+void ResourceStateTracker::EndSplitBarrier(ID3D12Resource* resource)
+{
+	for (size_t i = 0; i < splitBarriers.size(); ++i)
+	{
+		if (splitBarriers[i].Transition.pResource == resource)
+		{
+			pendingBarriers.push_back(splitBarriers[i]);
+			splitBarriers.erase(splitBarriers.begin() + i);
+			return;
+		}
+	}
+}
+
+bool ResourceStateTracker::MergeTransition(
+	const D3D12_RESOURCE_TRANSITION_BARRIER& transition)
+{
+	for (size_t i = pendingBarriers.size(); i > 0; --i)
+	{
+		D3D12_RESOURCE_BARRIER& existing = pendingBarriers[i - 1];
+		if (!ReferencesResource(existing, transition.pResource))
+			continue;
+
+		if (existing.Type != D3D12_RESOURCE_BARRIER_TYPE_TRANSITION ||
+			existing.Flags != D3D12_RESOURCE_BARRIER_FLAG_NONE ||
+			existing.Transition.Subresource != transition.Subresource ||
+			existing.Transition.StateAfter != transition.StateBefore)
+		{
+			return false;
+		}
+
+		existing.Transition.StateAfter = transition.StateAfter;
+		return true;
+	}
+
+	return false;
+}
+
+void ResourceStateTracker::IssueBarriers(ID3D12GraphicsCommandList* commandList,
+	D3D12_RESOURCE_BARRIER_FLAGS transitionFlag)
+{
+	// A split barrier has to end on the same command list that began it
+	if (splitBarrierList != nullptr && splitBarrierList != commandList)
+		throw std::runtime_error("Could not end split barriers on a different command list");
+
+	barriersToIssue.clear();
+	for (auto& barrier : pendingBarriers)
+	{
+		if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
+			barrier.Transition.StateBefore == barrier.Transition.StateAfter)
+		{
+			continue;
+		}
+
+		if (barrier.Flags != D3D12_RESOURCE_BARRIER_FLAG_END_ONLY)
+			++nrOfIssuedBarriers;
+
+		barriersToIssue.push_back(barrier);
+		if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
+			barrier.Flags == D3D12_RESOURCE_BARRIER_FLAG_NONE &&
+			transitionFlag == D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY)
+		{
+			barriersToIssue.back().Flags = D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+			splitBarriers.push_back(barrier);
+			splitBarriers.back().Flags = D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+		}
+	}
+
+	pendingBarriers.clear();
+	splitBarrierList = splitBarriers.size() != 0 ? commandList : nullptr;
+	if (barriersToIssue.size() != 0)
+	{
+		commandList->ResourceBarrier(static_cast<UINT>(barriersToIssue.size()),
+			barriersToIssue.data());
+	}
+}
+
+void ResourceStateTracker::AddBarrier(const D3D12_RESOURCE_BARRIER& barrier)
+{
+	++nrOfRequestedBarriers;
+
+	if (barrier.Type != D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+	{
+		pendingBarriers.push_back(barrier);
+		return;
+	}
+
+	EndSplitBarrier(barrier.Transition.pResource);
+
+	if (barrier.Transition.StateBefore == barrier.Transition.StateAfter)
+		return;
+
+	if (barrier.Flags != D3D12_RESOURCE_BARRIER_FLAG_NONE ||
+		!MergeTransition(barrier.Transition))
+	{
+		pendingBarriers.push_back(barrier);
+	}
+}
+
+void ResourceStateTracker::AddBarriers(
+	const std::vector<D3D12_RESOURCE_BARRIER>& barriers)
+{
+	for (auto& barrier : barriers)
+		AddBarrier(barrier);
+}
+
+void ResourceStateTracker::FlushBarriers(ID3D12GraphicsCommandList* commandList)
+{
+	IssueBarriers(commandList, D3D12_RESOURCE_BARRIER_FLAG_NONE);
+}
+
+void ResourceStateTracker::BeginSplitBarriers(
+	ID3D12GraphicsCommandList* commandList)
+{
+	IssueBarriers(commandList, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY);
+}
+
+void ResourceStateTracker::EndSplitBarriers(
+	ID3D12GraphicsCommandList* commandList)
+{
+	pendingBarriers.insert(pendingBarriers.begin(), splitBarriers.begin(),
+		splitBarriers.end());
+	splitBarriers.clear();
+	IssueBarriers(commandList, D3D12_RESOURCE_BARRIER_FLAG_NONE);
+}
+
+bool ResourceStateTracker::HasSplitBarriers() const
+{
+	return splitBarrierList != nullptr;
+}
+
+size_t ResourceStateTracker::GetNrOfRequestedBarriers() const
+{
+	return nrOfRequestedBarriers;
+}
+
+size_t ResourceStateTracker::GetNrOfIssuedBarriers() const
+{
+	return nrOfIssuedBarriers;
+}
+
+size_t ResourceStateTracker::GetNrOfSavedBarriers() const
+{
+	return nrOfRequestedBarriers - nrOfIssuedBarriers;
+}
\ No newline at end of file
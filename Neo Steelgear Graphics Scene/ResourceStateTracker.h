@@ -0,0 +1,42 @@
+#pragma once
+
+#include <d3d12.h>
+#include <vector>
+
+class ResourceStateTracker
+{
+private:
+	std::vector<D3D12_RESOURCE_BARRIER> pendingBarriers;
+	std::vector<D3D12_RESOURCE_BARRIER> splitBarriers;
+	std::vector<D3D12_RESOURCE_BARRIER> barriersToIssue;
+	ID3D12GraphicsCommandList* splitBarrierList = nullptr;
+	size_t nrOfRequestedBarriers = 0;
+	size_t nrOfIssuedBarriers = 0;
+
+	bool ReferencesResource(const D3D12_RESOURCE_BARRIER& barrier,
+		ID3D12Resource* resource) const;
+	void EndSplitBarrier(ID3D12Resource* resource);
+	bool MergeTransition(const D3D12_RESOURCE_TRANSITION_BARRIER& transition);
+	void IssueBarriers(ID3D12GraphicsCommandList* commandList,
+		D3D12_RESOURCE_BARRIER_FLAGS transitionFlag);
+
+public:
+	ResourceStateTracker() = default;
+	~ResourceStateTracker() = default;
+	ResourceStateTracker(const ResourceStateTracker& other) = delete;
+	ResourceStateTracker& operator=(const ResourceStateTracker& other) = delete;
+	ResourceStateTracker(ResourceStateTracker&& other) = default;
+	ResourceStateTracker& operator=(ResourceStateTracker&& other) = default;
+
+	void AddBarrier(const D3D12_RESOURCE_BARRIER& barrier);
+	void AddBarriers(const std::vector<D3D12_RESOURCE_BARRIER>& barriers);
+
+	void FlushBarriers(ID3D12GraphicsCommandList* commandList);
+	void BeginSplitBarriers(ID3D12GraphicsCommandList* commandList);
+	void EndSplitBarriers(ID3D12GraphicsCommandList* commandList);
+
+	bool HasSplitBarriers() const;
+	size_t GetNrOfRequestedBarriers() const;
+	size_t GetNrOfIssuedBarriers() const;
+	size_t GetNrOfSavedBarriers() const;
+};
\ No newline at end of file
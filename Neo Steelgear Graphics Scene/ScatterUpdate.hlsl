@@ -0,0 +1,21 @@
+cbuffer ScatterInfo : register(b0)
+{
+	uint nrOfUpdates;
+	uint elementStride;
+};
+
+ByteAddressBuffer packedUpdates : register(t0);
+RWByteAddressBuffer target : register(u0);
+
+[numthreads(64, 1, 1)]
+void main(uint3 threadID : SV_DispatchThreadID)
+{
+	if (threadID.x >= nrOfUpdates)
+		return;
+
+	uint recordStart = threadID.x * (elementStride + 4);
+	uint destination = packedUpdates.Load(recordStart) * elementStride;
+
+	for (uint offset = 0; offset < elementStride; offset += 4)
+		target.Store(destination + offset, packedUpdates.Load(recordStart + 4 + offset));
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "ScatterUpdateBatcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+void ScatterUpdateBatcher::Initialize(size_t elementStrideInBytes)
+{
+	if (elementStrideInBytes == 0 || elementStrideInBytes % 4 != 0)
+		throw std::runtime_error("Scatter update stride must be a non-zero multiple of 4");
+
+	elementStride = elementStrideInBytes;
+	Clear();
+}
+
+void ScatterUpdateBatcher::AddUpdate(std::uint32_t elementIndex,
+	const void* elementData)
+{
+	auto result = recordLookup.find(elementIndex);
+	size_t recordStart = 0;
+
+	if (result != recordLookup.end())
+	{
+		recordStart = result->second;
+	}
+	else
+	{
+		recordStart = packedUpdates.size();
+		packedUpdates.resize(recordStart + GetRecordStride());
+		std::memcpy(packedUpdates.data() + recordStart, &elementIndex,
+			sizeof(elementIndex));
+		recordLookup[elementIndex] = recordStart;
+		highestIndex = std::max(highestIndex, elementIndex);
+	}
+
+	std::memcpy(packedUpdates.data() + recordStart + sizeof(elementIndex),
+		elementData, elementStride);
+}
+
+void ScatterUpdateBatcher::Clear()
+{
+	packedUpdates.clear();
+	recordLookup.clear();
+	highestIndex = 0;
+}
+
+size_t ScatterUpdateBatcher::NrOfUpdates() const
+{
+	return recordLookup.size();
+}
+
+size_t ScatterUpdateBatcher::GetElementStride() const
+{
+	return elementStride;
+}
+
+size_t ScatterUpdateBatcher::GetRecordStride() const
+{
+	return elementStride + sizeof(std::uint32_t);
+}
+
+size_t ScatterUpdateBatcher::GetPackedSize() const
+{
+	return packedUpdates.size();
+}
+
+const unsigned char* ScatterUpdateBatcher::GetPackedData() const
+{
+	return packedUpdates.data();
+}
+
+std::uint32_t ScatterUpdateBatcher::GetHighestIndex() const
+{
+	return highestIndex;
+}
+
+size_t ScatterUpdateBatcher::NrOfContiguousRuns() const
+{
+	if (recordLookup.size() == 0)
+		return 0;
+
+	std::vector<std::uint32_t> indices;
+	indices.reserve(recordLookup.size());
+	for (auto& record : recordLookup)
+		indices.push_back(record.first);
+
+	std::sort(indices.begin(), indices.end());
+
+	size_t toReturn = 1;
+	for (size_t i = 1; i < indices.size(); ++i)
+		toReturn += indices[i] != indices[i - 1] + 1 ? 1 : 0;
+
+	return toReturn;
+}
+
+bool ScatterUpdateBatcher::ShouldScatter(size_t nrOfElementsInBuffer) const
+{
+	return NrOfContiguousRuns() > 1 &&
+		GetPackedSize() < nrOfElementsInBuffer * elementStride;
+}
\ No newline at end of file
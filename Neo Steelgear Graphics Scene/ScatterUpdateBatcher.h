@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class ScatterUpdateBatcher
+{
+private:
+	size_t elementStride = 0;
+	std::vector<unsigned char> packedUpdates;
+	std::unordered_map<std::uint32_t, size_t> recordLookup;
+	std::uint32_t highestIndex = 0;
+
+public:
+	ScatterUpdateBatcher() = default;
+	~ScatterUpdateBatcher() = default;
+	ScatterUpdateBatcher(const ScatterUpdateBatcher& other) = default;
+	ScatterUpdateBatcher& operator=(const ScatterUpdateBatcher& other) = default;
+	ScatterUpdateBatcher(ScatterUpdateBatcher&& other) = default;
+	ScatterUpdateBatcher& operator=(ScatterUpdateBatcher&& other) = default;
+
+	void Initialize(size_t elementStrideInBytes);
+
+	void AddUpdate(std::uint32_t elementIndex, const void* elementData);
+	void Clear();
+
+	size_t NrOfUpdates() const;
+	size_t GetElementStride() const;
+	size_t GetRecordStride() const;
+	size_t GetPackedSize() const;
+	const unsigned char* GetPackedData() const;
+	std::uint32_t GetHighestIndex() const;
+
+	size_t NrOfContiguousRuns() const;
+	bool ShouldScatter(size_t nrOfElementsInBuffer) const;
+};
\ No newline at end of file
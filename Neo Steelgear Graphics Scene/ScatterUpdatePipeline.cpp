@@ -0,0 +1,113 @@
+#include "ScatterUpdatePipeline.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#include <d3dcompiler.h>
+
+void ScatterUpdatePipeline::CreateRootSignature(ID3D12Device* device)
+{
+	D3D12_ROOT_PARAMETER rootParameters[3];
+	rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+	rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	rootParameters[0].Constants.ShaderRegister = 0;
+	rootParameters[0].Constants.RegisterSpace = 0;
+	rootParameters[0].Constants.Num32BitValues = 2;
+
+	rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+	rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	rootParameters[1].Descriptor.ShaderRegister = 0;
+	rootParameters[1].Descriptor.RegisterSpace = 0;
+
+	rootParameters[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_UAV;
+	rootParameters[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	rootParameters[2].Descriptor.ShaderRegister = 0;
+	rootParameters[2].Descriptor.RegisterSpace = 0;
+
+	D3D12_ROOT_SIGNATURE_DESC desc;
+	desc.NumParameters = 3;
+	desc.pParameters = rootParameters;
+	desc.NumStaticSamplers = 0;
+	desc.pStaticSamplers = nullptr;
+	desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
+
+	ID3DBlob* serialized;
+	ID3DBlob* error;
+	HRESULT hr = D3D12SerializeRootSignature(&desc,
+		D3D_ROOT_SIGNATURE_VERSION_1_0, &serialized, &error);
+
+	if (FAILED(hr))
+	{
+		std::string blobMessage =
+			std::string(static_cast<char*>(error->GetBufferPointer()));
+		throw std::runtime_error("Could not serialize scatter root signature: " +
+			blobMessage);
+	}
+
+	hr = device->CreateRootSignature(0, serialized->GetBufferPointer(),
+		serialized->GetBufferSize(), IID_PPV_ARGS(&rootSignature));
+	serialized->Release();
+
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create scatter root signature");
+}
+
+void ScatterUpdatePipeline::CreatePipelineState(ID3D12Device* device,
+	const std::string& shaderPath)
+{
+	std::ifstream file(shaderPath, std::ios::binary);
+
+	if (!file.is_open())
+		throw std::runtime_error("Could not open scatter update CSO file");
+
+	file.seekg(0, std::ios_base::end);
+	size_t size = static_cast<size_t>(file.tellg());
+	file.seekg(0, std::ios_base::beg);
+
+	ID3DBlob* shaderBlob = nullptr;
+	HRESULT hr = D3DCreateBlob(size, &shaderBlob);
+
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create blob when loading scatter CSO");
+
+	D3DPtr<ID3DBlob> shader(shaderBlob);
+	file.read(static_cast<char*>(shader->GetBufferPointer()), size);
+	file.close();
+
+	D3D12_COMPUTE_PIPELINE_STATE_DESC desc;
+	ZeroMemory(&desc, sizeof(D3D12_COMPUTE_PIPELINE_STATE_DESC));
+	desc.pRootSignature = rootSignature;
+	desc.CS.pShaderBytecode = shader->GetBufferPointer();
+	desc.CS.BytecodeLength = shader->GetBufferSize();
+	desc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
+
+	hr = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(&pipelineState));
+
+	if (FAILED(hr))
+		throw std::runtime_error("Could not create scatter pipeline state");
+}
+
+void ScatterUpdatePipeline::Initialize(ID3D12Device* device,
+	const std::string& shaderPath)
+{
+	CreateRootSignature(device);
+	CreatePipelineState(device, shaderPath);
+}
+
+void ScatterUpdatePipeline::SetPipelineState(
+	ID3D12GraphicsCommandList* commandList)
+{
+	commandList->SetComputeRootSignature(rootSignature);
+	commandList->SetPipelineState(pipelineState);
+}
+
+void ScatterUpdatePipeline::Dispatch(ID3D12GraphicsCommandList* commandList,
+	D3D12_GPU_VIRTUAL_ADDRESS packedUpdates, D3D12_GPU_VIRTUAL_ADDRESS target,
+	UINT nrOfUpdates, UINT elementStride)
+{
+	UINT constants[2] = { nrOfUpdates, elementStride };
+	commandList->SetComputeRoot32BitConstants(0, 2, constants, 0);
+	commandList->SetComputeRootShaderResourceView(1, packedUpdates);
+	commandList->SetComputeRootUnorderedAccessView(2, target);
+	commandList->Dispatch((nrOfUpdates + 63) / 64, 1, 1);
+}
\ No newline at end of file
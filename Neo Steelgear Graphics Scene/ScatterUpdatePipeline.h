@@ -0,0 +1,31 @@
+#pragma once
+
+#include <d3d12.h>
+#include <string>
+
+#include "D3DPtr.h"
+
+class ScatterUpdatePipeline
+{
+private:
+	D3DPtr<ID3D12RootSignature> rootSignature;
+	D3DPtr<ID3D12PipelineState> pipelineState;
+
+	void CreateRootSignature(ID3D12Device* device);
+	void CreatePipelineState(ID3D12Device* device, const std::string& shaderPath);
+
+public:
+	ScatterUpdatePipeline() = default;
+	~ScatterUpdatePipeline() = default;
+	ScatterUpdatePipeline(const ScatterUpdatePipeline& other) = delete;
+	ScatterUpdatePipeline& operator=(const ScatterUpdatePipeline& other) = delete;
+	ScatterUpdatePipeline(ScatterUpdatePipeline&& other) = default;
+	ScatterUpdatePipeline& operator=(ScatterUpdatePipeline&& other) = default;
+
+	void Initialize(ID3D12Device* device, const std::string& shaderPath);
+
+	void SetPipelineState(ID3D12GraphicsCommandList* commandList);
+	void Dispatch(ID3D12GraphicsCommandList* commandList,
+		D3D12_GPU_VIRTUAL_ADDRESS packedUpdates, D3D12_GPU_VIRTUAL_ADDRESS target,
+		UINT nrOfUpdates, UINT elementStride);
+};
\ No newline at end of file
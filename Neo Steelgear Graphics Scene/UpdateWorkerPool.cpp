@@ -0,0 +1,102 @@
+#include "UpdateWorkerPool.h"
+
+void UpdateWorkerPool::WorkerLoop(size_t workerIndex, size_t startGeneration)
+{
+	size_t seenGeneration = startGeneration;
+
+	while (true)
+	{
+		WorkerJob jobToRun = nullptr;
+		void* context = nullptr;
+
+		{
+			std::unique_lock<std::mutex> lock(poolMutex);
+			jobAvailable.wait(lock, [this, seenGeneration]()
+				{
+					return stopping || jobGeneration != seenGeneration;
+				});
+
+			if (stopping)
+				return;
+
+			seenGeneration = jobGeneration;
+			jobToRun = job;
+			context = jobContext;
+		}
+
+		try
+		{
+			jobToRun(context, workerIndex);
+		}
+		catch (...)
+		{
+			errors[workerIndex] = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> lock(poolMutex);
+		if (--workersLeft == 0)
+			jobFinished.notify_one();
+	}
+}
+
+void UpdateWorkerPool::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		stopping = true;
+	}
+
+	jobAvailable.notify_all();
+	for (auto& thread : threads)
+		thread.join();
+
+	threads.clear();
+	stopping = false;
+}
+
+UpdateWorkerPool::~UpdateWorkerPool()
+{
+	Shutdown();
+}
+
+void UpdateWorkerPool::Initialize(size_t nrOfWorkers)
+{
+	Shutdown();
+	errors.resize(nrOfWorkers);
+	threads.reserve(nrOfWorkers);
+
+	for (size_t i = 0; i < nrOfWorkers; ++i)
+		threads.emplace_back(&UpdateWorkerPool::WorkerLoop, this, i, jobGeneration);
+}
+
+void UpdateWorkerPool::Run(WorkerJob jobToRun, void* context)
+{
+	if (threads.size() == 0)
+		return;
+
+	std::unique_lock<std::mutex> lock(poolMutex);
+	job = jobToRun;
+	jobContext = context;
+	workersLeft = threads.size();
+	++jobGeneration;
+	jobAvailable.notify_all();
+	jobFinished.wait(lock, [this]() { return workersLeft == 0; });
+	lock.unlock();
+
+	for (auto& error : errors)
+	{
+		if (error)
+		{
+			std::exception_ptr toRethrow = error;
+			for (auto& toClear : errors)
+				toClear = nullptr;
+
+			std::rethrow_exception(toRethrow);
+		}
+	}
+}
+
+size_t UpdateWorkerPool::NrOfWorkers() const
+{
+	return threads.size();
+}
\ No newline at end of file
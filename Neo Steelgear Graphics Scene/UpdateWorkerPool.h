@@ -0,0 +1,41 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class UpdateWorkerPool
+{
+public:
+	typedef void (*WorkerJob)(void* context, size_t workerIndex);
+
+private:
+	std::vector<std::thread> threads;
+	std::vector<std::exception_ptr> errors;
+	std::mutex poolMutex;
+	std::condition_variable jobAvailable;
+	std::condition_variable jobFinished;
+	WorkerJob job = nullptr;
+	void* jobContext = nullptr;
+	size_t jobGeneration = 0;
+	size_t workersLeft = 0;
+	bool stopping = false;
+
+	void WorkerLoop(size_t workerIndex, size_t startGeneration);
+	void Shutdown();
+
+public:
+	UpdateWorkerPool() = default;
+	~UpdateWorkerPool();
+	UpdateWorkerPool(const UpdateWorkerPool& other) = delete;
+	UpdateWorkerPool& operator=(const UpdateWorkerPool& other) = delete;
+	UpdateWorkerPool(UpdateWorkerPool&& other) = delete;
+	UpdateWorkerPool& operator=(UpdateWorkerPool&& other) = delete;
+
+	void Initialize(size_t nrOfWorkers);
+
+	void Run(WorkerJob jobToRun, void* context);
+	size_t NrOfWorkers() const;
+};
\ No newline at end of file
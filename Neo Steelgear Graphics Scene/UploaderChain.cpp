@@ -0,0 +1,76 @@
+#include "UploaderChain.h"
+
+#include <algorithm>
+
+void UploaderChain::AddLink(size_t minimumSize)
+{
+	size_t linkSize = 65536 * ((std::max(minimumSize, baseSize) + 65535) / 65536);
+
+	links.push_back(ChainLink());
+	links.back().uploader.Initialize(device, linkSize, allocationStrategy);
+	links.back().size = linkSize;
+}
+
+void UploaderChain::Initialize(ID3D12Device* deviceToUse,
+	size_t minSizePerUploader, AllocationStrategy strategy,
+	size_t framesBeforeShrink)
+{
+	device = deviceToUse;
+	baseSize = minSizePerUploader;
+	allocationStrategy = strategy;
+	idleFramesBeforeShrink = framesBeforeShrink;
+	AddLink(baseSize);
+}
+
+ResourceUploader& UploaderChain::GetUploader(size_t nrOfBytes)
+{
+	size_t alignedBytes = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT *
+		((nrOfBytes + D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT - 1) /
+		D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+	while (links[activeLink].usedBytes + alignedBytes > links[activeLink].size)
+	{
+		if (++activeLink == links.size())
+			AddLink(alignedBytes);
+	}
+
+	links[activeLink].usedBytes += alignedBytes;
+	return links[activeLink].uploader;
+}
+
+void UploaderChain::RestoreUsedMemory()
+{
+	size_t usedBytes = 0;
+	for (auto& link : links)
+	{
+		link.uploader.RestoreUsedMemory();
+		link.idleFrames = link.usedBytes == 0 ? link.idleFrames + 1 : 0;
+		usedBytes += link.usedBytes;
+		link.usedBytes = 0;
+	}
+
+	peakUsage = std::max(peakUsage, usedBytes);
+	activeLink = 0;
+
+	while (links.size() > 1 && links.back().idleFrames >= idleFramesBeforeShrink)
+		links.pop_back();
+}
+
+size_t UploaderChain::GetCapacity() const
+{
+	size_t toReturn = 0;
+	for (auto& link : links)
+		toReturn += link.size;
+
+	return toReturn;
+}
+
+size_t UploaderChain::GetPeakUsage() const
+{
+	return peakUsage;
+}
+
+size_t UploaderChain::NrOfLinks() const
+{
+	return links.size();
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <d3d12.h>
+#include <vector>
+
+#include "ResourceUploader.h"
+
+class UploaderChain
+{
+private:
+	struct ChainLink
+	{
+		ResourceUploader uploader;
+		size_t size = 0;
+		size_t usedBytes = 0;
+		size_t idleFrames = 0;
+	};
+
+	ID3D12Device* device = nullptr;
+	size_t baseSize = 0;
+	AllocationStrategy allocationStrategy;
+	size_t idleFramesBeforeShrink = 0;
+	std::vector<ChainLink> links;
+	size_t activeLink = 0;
+	size_t peakUsage = 0;
+
+	void AddLink(size_t minimumSize);
+
+public:
+	UploaderChain() = default;
+	~UploaderChain() = default;
+	UploaderChain(const UploaderChain& other) = delete;
+	UploaderChain& operator=(const UploaderChain& other) = delete;
+	UploaderChain(UploaderChain&& other) = default;
+	UploaderChain& operator=(UploaderChain&& other) = default;
+
+	void Initialize(ID3D12Device* deviceToUse, size_t minSizePerUploader,
+		AllocationStrategy strategy, size_t framesBeforeShrink);
+
+	ResourceUploader& GetUploader(size_t nrOfBytes);
+	void RestoreUsedMemory();
+
+	size_t GetCapacity() const;
+	size_t GetPeakUsage() const;
+	size_t NrOfLinks() const;
+};
\ No newline at end of file
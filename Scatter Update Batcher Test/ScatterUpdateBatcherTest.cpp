@@ -0,0 +1,142 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+
+#include "ScatterUpdateBatcher.h"
+
+struct Element
+{
+	float values[3];
+	std::uint32_t tag;
+};
+
+static int nrOfFailures = 0;
+
+void Check(bool condition, const char* description)
+{
+	if (!condition)
+	{
+		std::printf("FAILED: %s\n", description);
+		++nrOfFailures;
+	}
+}
+
+const Element* FindRecord(const ScatterUpdateBatcher& batcher,
+	std::uint32_t elementIndex)
+{
+	const unsigned char* packed = batcher.GetPackedData();
+	for (size_t offset = 0; offset < batcher.GetPackedSize();
+		offset += batcher.GetRecordStride())
+	{
+		std::uint32_t recordIndex = 0;
+		std::memcpy(&recordIndex, packed + offset, sizeof(recordIndex));
+		if (recordIndex == elementIndex)
+		{
+			return reinterpret_cast<const Element*>(
+				packed + offset + sizeof(recordIndex));
+		}
+	}
+
+	return nullptr;
+}
+
+void TestDeduplication()
+{
+	ScatterUpdateBatcher batcher;
+	batcher.Initialize(sizeof(Element));
+
+	Element first = { { 1.0f, 2.0f, 3.0f }, 1 };
+	Element second = { { 4.0f, 5.0f, 6.0f }, 2 };
+	Element other = { { 7.0f, 8.0f, 9.0f }, 3 };
+	batcher.AddUpdate(5, &first);
+	batcher.AddUpdate(9, &other);
+	batcher.AddUpdate(5, &second);
+
+	Check(batcher.NrOfUpdates() == 2, "repeated index is stored once");
+	Check(batcher.GetPackedSize() == 2 * batcher.GetRecordStride(),
+		"packed size matches number of unique records");
+	Check(batcher.GetRecordStride() == sizeof(Element) + sizeof(std::uint32_t),
+		"record stride is index plus element");
+	Check(batcher.GetHighestIndex() == 9, "highest index is tracked");
+
+	const Element* record = FindRecord(batcher, 5);
+	Check(record != nullptr && record->tag == 2 && record->values[0] == 4.0f,
+		"last write to an index wins");
+	record = FindRecord(batcher, 9);
+	Check(record != nullptr && record->tag == 3, "other records are untouched");
+
+	batcher.Clear();
+	Check(batcher.NrOfUpdates() == 0 && batcher.GetPackedSize() == 0 &&
+		batcher.GetHighestIndex() == 0, "clear resets the batch");
+}
+
+void TestContiguousRuns()
+{
+	ScatterUpdateBatcher batcher;
+	batcher.Initialize(sizeof(Element));
+	Element element = {};
+
+	Check(batcher.NrOfContiguousRuns() == 0, "empty batch has no runs");
+
+	for (std::uint32_t index : { 3u, 1u, 2u })
+		batcher.AddUpdate(index, &element);
+
+	Check(batcher.NrOfContiguousRuns() == 1, "unordered adjacent indices form one run");
+
+	batcher.AddUpdate(10, &element);
+	batcher.AddUpdate(7, &element);
+	batcher.AddUpdate(3, &element);
+
+	Check(batcher.NrOfContiguousRuns() == 3, "gaps split the indices into runs");
+}
+
+void TestShouldScatter()
+{
+	ScatterUpdateBatcher batcher;
+	batcher.Initialize(sizeof(Element));
+	Element element = {};
+
+	batcher.AddUpdate(0, &element);
+	batcher.AddUpdate(1, &element);
+	Check(!batcher.ShouldScatter(1000), "a single run is copied instead");
+
+	batcher.AddUpdate(500, &element);
+	Check(batcher.ShouldScatter(1000), "sparse updates in a large buffer scatter");
+	Check(!batcher.ShouldScatter(3), "updates covering a small buffer are copied");
+}
+
+void TestInvalidStride()
+{
+	ScatterUpdateBatcher batcher;
+	bool threw = false;
+
+	try
+	{
+		batcher.Initialize(6);
+	}
+	catch (const std::exception&)
+	{
+		threw = true;
+	}
+
+	Check(threw, "stride that is not a multiple of 4 is rejected");
+}
+
+int main()
+{
+	TestDeduplication();
+	TestContiguousRuns();
+	TestShouldScatter();
+	TestInvalidStride();
+
+	if (nrOfFailures != 0)
+	{
+		std::printf("%d check(s) failed\n", nrOfFailures);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("All scatter update batcher checks passed\n");
+	return EXIT_SUCCESS;
+}
\ No newline at end of file